@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+This script writes the synthetic wind fields and source files used by the
+CARIBOU benchmarks to benchmark/wind. The wind fields cover a 200 x 200 km
+region (up to 3 km high in 3D), on a 2 km horizontal grid, and are either
+constant or vary over 24 hourly data times (a veering, height dependant wind).
+
+Outputs:
+    wind_{2d,3d}_{constant,varying}.cwf (binary wind field files).
+    csv_3d_varying/ (u.csv, v.csv, w.csv and coords.csv, the csv format read
+    by STMaterial, to benchmark the csv ingestion).
+    points.csv and rates.csv (256 release points for MultiPointSource).
+"""
+import os
+import sys
+import numpy as np
+import pandas as pd
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                '..', 'python'))
+import wind_binary_utils as wbu
+
+OUTPUT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'wind')
+
+def build_axes(num_dims, varying):
+    """
+    Returns the x, y, z and t axes of a synthetic wind field.
+    """
+    x = np.arange(0.0, 200001.0, 2000.0)
+    y = np.arange(0.0, 200001.0, 2000.0)
+    z = np.array([0.0, 100.0, 250.0, 500.0, 1000.0, 1500.0, 2000.0, 3000.0]) \
+        if num_dims == 3 else np.zeros(1)
+    t = np.arange(0.0, 24*3600.0 + 1.0, 3600.0) if varying else np.zeros(1)
+    return x, y, z, t
+
+def build_components(x, y, z, t, num_dims):
+    """
+    Returns the velocity components of a veering wind with a logarithmic
+    profile, as arrays of shape (nt, nx*ny*nz) in the csv data ordering (the
+    z index varies the fastest, the x index the slowest).
+    """
+    xx, yy, zz = np.meshgrid(x, y, z, indexing='ij')
+    profile = np.log1p(zz/10.0)/np.log1p(100.0) if num_dims == 3 else 1.0
+    components = [[] for _ in range(num_dims)]
+    for time in t:
+        direction = 0.3 + 2.0*np.pi*time/(24*3600.0) + 1e-5*yy
+        speed = 8.0*profile*(1.0 + 0.1*np.sin(2.0*np.pi*xx/50000.0))
+        components[0].append((speed*np.cos(direction)).ravel())
+        components[1].append((speed*np.sin(direction)).ravel())
+        if num_dims == 3:
+            components[2].append((0.05*np.sin(2.0*np.pi*xx/40000.0)
+                                  *np.sin(np.pi*zz/3000.0)).ravel())
+    return [np.array(c) for c in components]
+
+def write_csv(directory, x, y, z, t, components):
+    """
+    Writes a wind field in the csv format read by STMaterial.
+    """
+    os.makedirs(directory, exist_ok=True)
+    for name, component in zip(['u', 'v', 'w'], components):
+        frame = pd.DataFrame({name + str(i): component[i]
+                              for i in range(len(t))})
+        frame.to_csv(os.path.join(directory, name + '.csv'), index=False)
+
+    #Pad the axes with zeros to the length of the longest one.
+    largest = max(len(x), len(y), len(z), len(t))
+    coords = {}
+    for name, axis in zip(['x', 'y', 'z', 't'], [x, y, z, t]):
+        coords[name] = np.concatenate([axis, np.zeros(largest - len(axis))])
+    pd.DataFrame(coords).to_csv(os.path.join(directory, 'coords.csv'),
+                                index=False)
+
+def write_sources(n_points=256):
+    """
+    Writes the release points and rates of a line of sources.
+    """
+    rng = np.random.default_rng(3)
+    points = pd.DataFrame({'x': rng.uniform(1000.0, 19000.0, n_points),
+                           'y': rng.uniform(1000.0, 19000.0, n_points),
+                           'z': rng.uniform(10.0, 200.0, n_points)})
+    points.to_csv(os.path.join(OUTPUT_DIR, 'points.csv'), index=False)
+
+    rates = {'time': [0.0, 3600.0, 7200.0]}
+    for i in range(n_points):
+        rates['source_' + str(i)] = [1.0, 0.5, 0.0]
+    pd.DataFrame(rates).to_csv(os.path.join(OUTPUT_DIR, 'rates.csv'),
+                               index=False)
+
+def generate_all(force=False):
+    """
+    Writes every benchmark input file which does not exist yet (or all of
+    them if force is set).
+    """
+    os.makedirs(OUTPUT_DIR, exist_ok=True)
+    for num_dims in (2, 3):
+        for varying in (False, True):
+            name = 'wind_%dd_%s.cwf' % (num_dims,
+                                        'varying' if varying else 'constant')
+            path = os.path.join(OUTPUT_DIR, name)
+            if os.path.exists(path) and not force:
+                continue
+            x, y, z, t = build_axes(num_dims, varying)
+            components = build_components(x, y, z, t, num_dims)
+            wbu.write_wind_binary(path, x, y, z, t, components)
+            print('Wrote ' + path)
+
+    csv_dir = os.path.join(OUTPUT_DIR, 'csv_3d_varying')
+    if force or not os.path.exists(os.path.join(csv_dir, 'coords.csv')):
+        x, y, z, t = build_axes(3, True)
+        write_csv(csv_dir, x, y, z, t, build_components(x, y, z, t, 3))
+        print('Wrote ' + csv_dir)
+
+    if force or not os.path.exists(os.path.join(OUTPUT_DIR, 'points.csv')):
+        write_sources()
+
+if __name__ == '__main__':
+    generate_all(force='--force' in sys.argv)
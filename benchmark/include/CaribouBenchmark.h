@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+/**
+ * Minimal registry and runner for the CARIBOU microbenchmarks.
+ *
+ * A benchmark body runs a number of iterations of the measured operation and
+ * returns the number of operations performed (e.g. the number of points
+ * sampled). The runner doubles the iteration count until a sample lasts at
+ * least the minimum sample time, then measures a series of samples and
+ * reports the best and median time per operation, along with the memory high
+ * water mark of the process, as one JSON object per line.
+ */
+namespace CaribouBenchmark
+{
+/// Runs n_iterations of the measured operation, returns the operation count.
+typedef std::function<std::size_t(std::size_t n_iterations)> Body;
+
+/// Registers a benchmark under a unique name.
+void add(const std::string & name, const Body & body);
+
+/// Runs every benchmark whose name contains filter, returns 0 on success.
+int runAll(const std::string & filter, double min_sample_time, unsigned int n_samples);
+
+/// Prevents the compiler from discarding a computed value.
+void keep(double value);
+
+/// Registers a benchmark at static initialization.
+struct Registrar
+{
+  Registrar(const std::string & name, const Body & body) { add(name, body); }
+};
+}
+
+#define CARIBOU_BENCHMARK(name)                                                                    \
+  static std::size_t name(std::size_t n_iterations);                                              \
+  static CaribouBenchmark::Registrar name##_registrar(#name, name);                                \
+  static std::size_t name(std::size_t n_iterations)
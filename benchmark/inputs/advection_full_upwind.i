@@ -0,0 +1,40 @@
+# STAdvection with full upwinding on a 40x40x10 HEX8 mesh.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 40
+  nz = 10
+  xmin = 0.0
+  xmax = 20000.0
+  ymin = 0.0
+  ymax = 20000.0
+  zmin = 0.0
+  zmax = 2000.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[Kernels]
+  [./advection]
+    type = STAdvection
+    variable = c
+    upwinding_type = full
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = STMaterial
+    diffusivity = 10.0
+    const_velocity = '5.0 2.0 0.1'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
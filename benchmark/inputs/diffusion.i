@@ -0,0 +1,39 @@
+# STDiffusion with an anisotropic diffusivity on a 40x40x10 HEX8 mesh.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 40
+  nz = 10
+  xmin = 0.0
+  xmax = 20000.0
+  ymin = 0.0
+  ymax = 20000.0
+  zmin = 0.0
+  zmax = 2000.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = STDiffusion
+    variable = c
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = STMaterial
+    diffusivity = '50.0 50.0 5.0'
+    const_velocity = '5.0 2.0 0.1'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
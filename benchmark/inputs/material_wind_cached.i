@@ -0,0 +1,42 @@
+# STMaterial interpolating a synthetic binary wind field (written by
+# generate_wind.py) at every quadrature point of a 40x40x10 HEX8 mesh,
+# with cache_velocity = true. Only STAdvection uses the properties.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 40
+  nz = 10
+  xmin = 0.0
+  xmax = 20000.0
+  ymin = 0.0
+  ymax = 20000.0
+  zmin = 0.0
+  zmax = 2000.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[Kernels]
+  [./advection]
+    type = STAdvection
+    variable = c
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = STMaterial
+    diffusivity = 10.0
+    wind_file_name = ../wind/wind_3d_varying.cwf
+    cache_velocity = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
@@ -0,0 +1,42 @@
+# MultiPointSource with 256 release points on a 40x40x10 HEX8 mesh. The
+# source files are written by generate_wind.py.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 40
+  nz = 10
+  xmin = 0.0
+  xmax = 20000.0
+  ymin = 0.0
+  ymax = 20000.0
+  zmin = 0.0
+  zmax = 2000.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[DiracKernels]
+  [./sources]
+    type = MultiPointSource
+    variable = c
+    points_file = ../wind/points.csv
+    rates_file = ../wind/rates.csv
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = STMaterial
+    diffusivity = 10.0
+    const_velocity = '5.0 2.0 0.1'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
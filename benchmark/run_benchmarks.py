@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+This is the driver of the CARIBOU performance benchmarks. It runs the
+microbenchmarks (caribou-benchmark-$METHOD, built in this directory with
+make) and the scenario inputs of scenarios/ over a matrix of wind fields,
+mesh sizes, MPI ranks and threads, and writes the results to a json file so
+that they can be compared across commits.
+
+Every scenario reports per-phase timings (residual and Jacobian evaluation,
+solve, output and total, from the PerfGraph) and the memory high water mark
+through its postprocessors, read back from the csv output.
+
+Usage (from the benchmark directory):
+    ./run_benchmarks.py -o results.json
+    ./run_benchmarks.py --sizes 1 2 4 --ranks 1 4 --threads 1 2 -o new.json
+    ./run_benchmarks.py --compare results.json new.json
+"""
+import argparse
+import datetime
+import json
+import os
+import platform
+import subprocess
+import sys
+import time
+import pandas as pd
+
+import generate_wind
+
+BENCHMARK_DIR = os.path.dirname(os.path.abspath(__file__))
+
+#Scenario inputs, their base mesh sizes (scaled by --sizes, vertically
+#unchanged) and the wind fields they are run with.
+SCENARIOS = {
+    'transport_2d': {'mesh': {'nx': 50, 'ny': 50},
+                     'winds': ['wind_2d_constant.cwf', 'wind_2d_varying.cwf']},
+    'transport_3d': {'mesh': {'nx': 40, 'ny': 40, 'nz': 8},
+                     'winds': ['wind_3d_constant.cwf', 'wind_3d_varying.cwf']},
+    'transport_3d_csv': {'mesh': {'nx': 40, 'ny': 40, 'nz': 8},
+                         'winds': [None]},
+    'multi_nuclide_3d': {'mesh': {'nx': 40, 'ny': 40, 'nz': 8},
+                         'winds': ['wind_3d_varying.cwf']},
+}
+
+def git_revision():
+    """
+    Returns the commit the benchmarks are run on.
+    """
+    try:
+        return subprocess.check_output(['git', 'rev-parse', 'HEAD'],
+                                       cwd=BENCHMARK_DIR,
+                                       universal_newlines=True).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return 'unknown'
+
+def run_micro(executable, filter_string):
+    """
+    Runs the microbenchmarks and returns their results.
+    """
+    if not os.path.exists(executable):
+        print('Skipping the microbenchmarks, ' + executable + ' is missing.')
+        return []
+
+    output = subprocess.check_output([executable, '--filter', filter_string],
+                                     cwd=BENCHMARK_DIR,
+                                     universal_newlines=True)
+    return [json.loads(line) for line in output.splitlines()
+            if line.startswith('{')]
+
+def run_scenario(executable, name, wind, size, ranks, threads, mpiexec):
+    """
+    Runs a scenario and returns its timings and memory usage.
+    """
+    label = '%s_%s_s%d_n%d_t%d' % (name, (wind or 'csv').split('.')[0],
+                                   size, ranks, threads)
+    arguments = ['-i', os.path.join('scenarios', name + '.i'),
+                 '--n-threads=%d' % threads,
+                 'Outputs/file_base=results/' + label]
+    for key, value in SCENARIOS[name]['mesh'].items():
+        arguments.append('Mesh/%s=%d' % (key, value*size if key != 'nz'
+                                         else value))
+    if wind:
+        arguments.append('Materials/wind/wind_file_name=../wind/' + wind)
+
+    command = [executable] + arguments
+    if ranks > 1:
+        command = [mpiexec, '-n', str(ranks)] + command
+
+    print('Running ' + label)
+    start = time.time()
+    subprocess.check_call(command, cwd=BENCHMARK_DIR,
+                          stdout=subprocess.DEVNULL)
+    wall_time = time.time() - start
+
+    result = {'scenario': name, 'wind': wind or 'csv', 'size': size,
+              'ranks': ranks, 'threads': threads, 'label': label,
+              'wall_time': wall_time}
+    data = pd.read_csv(os.path.join(BENCHMARK_DIR, 'results', label + '.csv'))
+    for column in data.columns:
+        if column != 'time':
+            result[column] = float(data[column].iloc[-1])
+    return result
+
+def compare(baseline_file, new_file, threshold):
+    """
+    Prints the relative change of every timing between two result files, and
+    returns the number of regressions beyond the threshold.
+    """
+    with open(baseline_file) as inp:
+        baseline = json.load(inp)
+    with open(new_file) as inp:
+        new = json.load(inp)
+
+    regressions = 0
+    def report(name, key, old, value):
+        nonlocal regressions
+        if not old:
+            return
+        change = value/old - 1.0
+        flag = ''
+        if change > threshold:
+            flag = '  <-- regression'
+            regressions += 1
+        print('%-60s %-14s %12.4g %12.4g %+7.1f%%%s'
+              % (name, key, old, value, 100.0*change, flag))
+
+    old_micro = {entry['benchmark']: entry for entry in baseline['micro']}
+    for entry in new['micro']:
+        if entry['benchmark'] in old_micro:
+            report(entry['benchmark'], 'best_ns',
+                   old_micro[entry['benchmark']]['best_ns'], entry['best_ns'])
+
+    old_scenarios = {entry['label']: entry for entry in baseline['scenarios']}
+    for entry in new['scenarios']:
+        old = old_scenarios.get(entry['label'])
+        if old is None:
+            continue
+        for key in ('wall_time', 'residual_time', 'jacobian_time',
+                    'solve_time', 'peak_memory'):
+            if key in entry and key in old:
+                report(entry['label'], key, old[key], entry[key])
+
+    print('%d regression(s) beyond %.0f%% (%s -> %s).'
+          % (regressions, 100.0*threshold, baseline['commit'][:10],
+             new['commit'][:10]))
+    return regressions
+
+def main():
+    method = os.environ.get('METHOD', 'opt')
+    parser = argparse.ArgumentParser(description='Run the CARIBOU '
+                                     'performance benchmarks.')
+    parser.add_argument('--executable',
+                        default=os.path.join(BENCHMARK_DIR, '..',
+                                             'caribou-' + method),
+                        help='CARIBOU executable running the scenarios')
+    parser.add_argument('--micro-executable',
+                        default=os.path.join(BENCHMARK_DIR,
+                                             'caribou-benchmark-' + method),
+                        help='microbenchmark executable')
+    parser.add_argument('--scenarios', nargs='+', default=list(SCENARIOS),
+                        choices=list(SCENARIOS), help='scenarios to run')
+    parser.add_argument('--sizes', nargs='+', type=int, default=[1, 2],
+                        help='horizontal mesh refinement factors')
+    parser.add_argument('--ranks', nargs='+', type=int, default=[1],
+                        help='numbers of MPI ranks')
+    parser.add_argument('--threads', nargs='+', type=int, default=[1],
+                        help='numbers of threads per rank')
+    parser.add_argument('--mpiexec', default='mpiexec',
+                        help='MPI launcher')
+    parser.add_argument('--filter', default='',
+                        help='only run the microbenchmarks matching filter')
+    parser.add_argument('--no-micro', action='store_true',
+                        help='skip the microbenchmarks')
+    parser.add_argument('--no-scenarios', action='store_true',
+                        help='skip the scenarios')
+    parser.add_argument('-o', '--output', default='results.json',
+                        help='json result file')
+    parser.add_argument('--compare', nargs=2, metavar=('BASELINE', 'NEW'),
+                        help='compare two result files instead of running')
+    parser.add_argument('--threshold', type=float, default=0.05,
+                        help='relative slowdown reported as a regression')
+    args = parser.parse_args()
+
+    if args.compare:
+        sys.exit(1 if compare(args.compare[0], args.compare[1],
+                              args.threshold) else 0)
+
+    generate_wind.generate_all()
+    os.makedirs(os.path.join(BENCHMARK_DIR, 'results'), exist_ok=True)
+
+    results = {'commit': git_revision(),
+               'date': datetime.datetime.now().isoformat(),
+               'host': platform.node(),
+               'method': method,
+               'micro': [],
+               'scenarios': []}
+
+    if not args.no_micro:
+        results['micro'] = run_micro(args.micro_executable, args.filter)
+
+    if not args.no_scenarios:
+        for name in args.scenarios:
+            for wind in SCENARIOS[name]['winds']:
+                for size in args.sizes:
+                    for ranks in args.ranks:
+                        for threads in args.threads:
+                            results['scenarios'].append(
+                                run_scenario(args.executable, name, wind, size,
+                                             ranks, threads, args.mpiexec))
+
+    with open(args.output, 'w') as out:
+        json.dump(results, out, indent=2)
+    print('Results written to ' + args.output)
+
+if __name__ == '__main__':
+    main()
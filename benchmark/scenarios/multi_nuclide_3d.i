@@ -0,0 +1,133 @@
+# 3D transport of a small source term inventory (Te-132 -> I-132, Cs-137)
+# held in a single array variable, over a 200 x 200 x 3 km region in a
+# synthetic wind field. The driver (run_benchmarks.py) overrides the mesh
+# size and the wind file. The inventory is released as an initial puff.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 40
+  nz = 8
+  xmin = 0.0
+  xmax = 200000.0
+  ymin = 0.0
+  ymax = 200000.0
+  zmin = 0.0
+  zmax = 3000.0
+[]
+
+[Functions]
+  [./puff]
+    type = ParsedFunction
+    value = 'exp(-((x - 100000)^2 + (y - 100000)^2)/2e7 - (z - 100)^2/2e4)'
+  [../]
+[]
+
+[Variables]
+  [./c]
+    components = 3
+
+    [./InitialCondition]
+      type = ArrayFunctionIC
+      function = 'puff puff puff'
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = STArrayDiffusion
+    variable = c
+  [../]
+  [./advection]
+    type = STArrayAdvection
+    variable = c
+  [../]
+  [./decay]
+    type = STArrayDecayChain
+    variable = c
+    decay_constants = '2.507e-6 8.390e-5 7.302e-10'
+    parents = '0'
+    daughters = '1'
+    branching_fractions = '1.0'
+  [../]
+  [./time]
+    type = ArrayTimeDerivative
+    variable = c
+    time_derivative_coefficient = 1.0
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = STMaterial
+    diffusivity = '100.0 100.0 10.0'
+    wind_file_name = ../wind/wind_3d_varying.cwf
+    time_dependance = true
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_time]
+    type = PerfGraphData
+    section_name = FEProblem::computeResidualInternal
+    data_type = TOTAL
+  [../]
+  [./jacobian_time]
+    type = PerfGraphData
+    section_name = FEProblem::computeJacobianInternal
+    data_type = TOTAL
+  [../]
+  [./residual_calls]
+    type = PerfGraphData
+    section_name = FEProblem::computeResidualInternal
+    data_type = CALLS
+  [../]
+  [./jacobian_calls]
+    type = PerfGraphData
+    section_name = FEProblem::computeJacobianInternal
+    data_type = CALLS
+  [../]
+  [./solve_time]
+    type = PerfGraphData
+    section_name = FEProblem::solve
+    data_type = TOTAL
+  [../]
+  [./output_time]
+    type = PerfGraphData
+    section_name = FEProblem::outputStep
+    data_type = TOTAL
+  [../]
+  [./total_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    report_peak_value = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'bjacobi'
+  num_steps = 6
+  dt = 600
+[]
+
+[Outputs]
+  csv = true
+  execute_on = final
+[]
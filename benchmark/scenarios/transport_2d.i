@@ -0,0 +1,119 @@
+# 2D transport of a single nuclide over a 200 x 200 km region in a synthetic
+# wind field. The driver (run_benchmarks.py) overrides the mesh size and the
+# wind file (wind_2d_constant.cwf or wind_2d_varying.cwf).
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 50
+  ny = 50
+  xmin = 0.0
+  xmax = 200000.0
+  ymin = 0.0
+  ymax = 200000.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[Kernels]
+  [./transport]
+    type = STTransport
+    variable = c
+    decay = true
+  [../]
+  [./time]
+    type = STTimeDerivative
+    variable = c
+  [../]
+[]
+
+[DiracKernels]
+  [./source]
+    type = ConstantPointSource
+    variable = c
+    value = 1.0
+    point = '100000.0 100000.0 0.0'
+  [../]
+[]
+
+[BCs]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = c
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = GenericCaribouMaterial
+    diffusivity = 100.0
+    wind_file_name = ../wind/wind_2d_varying.cwf
+    time_dependance = true
+    decay_constant = 1e-6
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_time]
+    type = PerfGraphData
+    section_name = FEProblem::computeResidualInternal
+    data_type = TOTAL
+  [../]
+  [./jacobian_time]
+    type = PerfGraphData
+    section_name = FEProblem::computeJacobianInternal
+    data_type = TOTAL
+  [../]
+  [./residual_calls]
+    type = PerfGraphData
+    section_name = FEProblem::computeResidualInternal
+    data_type = CALLS
+  [../]
+  [./jacobian_calls]
+    type = PerfGraphData
+    section_name = FEProblem::computeJacobianInternal
+    data_type = CALLS
+  [../]
+  [./solve_time]
+    type = PerfGraphData
+    section_name = FEProblem::solve
+    data_type = TOTAL
+  [../]
+  [./output_time]
+    type = PerfGraphData
+    section_name = FEProblem::outputStep
+    data_type = TOTAL
+  [../]
+  [./total_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    report_peak_value = true
+  [../]
+  [./mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = c
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'bjacobi'
+  num_steps = 6
+  dt = 600
+[]
+
+[Outputs]
+  csv = true
+  execute_on = final
+[]
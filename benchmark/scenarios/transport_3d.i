@@ -0,0 +1,133 @@
+# 3D transport of a single nuclide with settling, wet and dry deposition over
+# a 200 x 200 x 3 km region in a synthetic wind field. The driver
+# (run_benchmarks.py) overrides the mesh size and the wind file
+# (wind_3d_constant.cwf or wind_3d_varying.cwf).
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 40
+  nz = 8
+  xmin = 0.0
+  xmax = 200000.0
+  ymin = 0.0
+  ymax = 200000.0
+  zmin = 0.0
+  zmax = 3000.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[Kernels]
+  [./transport]
+    type = STTransport
+    variable = c
+    decay = true
+    settling = true
+    wet_deposition = true
+  [../]
+  [./time]
+    type = STTimeDerivative
+    variable = c
+  [../]
+[]
+
+[DiracKernels]
+  [./source]
+    type = ConstantPointSource
+    variable = c
+    value = 1.0
+    point = '100000.0 100000.0 50.0'
+  [../]
+[]
+
+[BCs]
+  [./ground]
+    type = DryDepositionBC
+    variable = c
+    boundary = back
+    dry_deposition_velocity = 0.005
+  [../]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = c
+    boundary = 'left right top bottom front'
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = GenericCaribouMaterial
+    diffusivity = '100.0 100.0 10.0'
+    wind_file_name = ../wind/wind_3d_varying.cwf
+    time_dependance = true
+    decay_constant = 1e-6
+    settling_velocity = -0.01
+    wet_scavenge_constant = 1e-5
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_time]
+    type = PerfGraphData
+    section_name = FEProblem::computeResidualInternal
+    data_type = TOTAL
+  [../]
+  [./jacobian_time]
+    type = PerfGraphData
+    section_name = FEProblem::computeJacobianInternal
+    data_type = TOTAL
+  [../]
+  [./residual_calls]
+    type = PerfGraphData
+    section_name = FEProblem::computeResidualInternal
+    data_type = CALLS
+  [../]
+  [./jacobian_calls]
+    type = PerfGraphData
+    section_name = FEProblem::computeJacobianInternal
+    data_type = CALLS
+  [../]
+  [./solve_time]
+    type = PerfGraphData
+    section_name = FEProblem::solve
+    data_type = TOTAL
+  [../]
+  [./output_time]
+    type = PerfGraphData
+    section_name = FEProblem::outputStep
+    data_type = TOTAL
+  [../]
+  [./total_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    report_peak_value = true
+  [../]
+  [./mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = c
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'bjacobi'
+  num_steps = 6
+  dt = 600
+[]
+
+[Outputs]
+  csv = true
+  execute_on = final
+[]
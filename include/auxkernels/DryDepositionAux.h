@@ -0,0 +1,40 @@
+#pragma once
+
+#include "AuxKernel.h"
+
+/**
+ * Accumulates the amount deposited per unit area on a boundary by dry
+ * deposition, v_d c, and by settling through the boundary, over the time
+ * steps. Settling deposits max(0, w n_z) c as in DryDepositionBC: elemental
+ * fields use the normal of the side, nodal fields require a boundary facing
+ * down (n_z = -1) when settling. Uses the concentration at the end of each
+ * time step, consistently with the implicit DryDepositionBC.
+ */
+class DryDepositionAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  DryDepositionAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  /// Errors unless the outward normal of every side of the boundary points down.
+  void checkGroundFacing() const;
+
+  /// Concentration of the depositing species.
+  const VariableValue & _concentration;
+
+  /// Dry deposition velocity used by DryDepositionBC.
+  const Real _dry_deposition_velocity;
+
+  /// Settling velocity (z component) used by DryDepositionBC.
+  const Real _settling_velocity;
+
+  /// Deposited amount at the previous time step.
+  const VariableValue & _deposit_old;
+
+  /// Normals of the side for elemental fields, nullptr for nodal fields.
+  const MooseArray<Point> * const _normals;
+};
@@ -4,7 +4,8 @@
 
 /**
  * Implements a dry deposition boundary condition, which is a variation of a
- * mass-flux boundary condition.
+ * mass-flux boundary condition. The flux of settling particles leaving
+ * through the boundary is deposited as well.
  */
 class DryDepositionBC : public IntegratedBC
 {
@@ -19,4 +20,10 @@ protected:
 
   /// Dry deposition constant to be used at the boundary.
   Real _dry_deposition_const;
+
+  /// Settling velocity (z component) of the species.
+  const Real _settling_velocity;
+
+  /// Returns the deposition velocity at the current quadrature point.
+  Real depositionVelocity() const;
 };
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "IntegratedBC.h"
+
+/**
+ * Flux across the boundary of a nested (fine) domain. The upwind advective
+ * flux carries the concentration of the domain on outflow and the
+ * concentration of the coarse domain holding it (transferred to an auxiliary
+ * variable) on inflow, and the diffusive flux is that of the coarse
+ * concentration, such that the mass crossing the interface is the same as in
+ * the coarse domain. Uses the velocity and diffusivity supplied by the
+ * materials system.
+ */
+class NestedBoundaryBC : public IntegratedBC
+{
+public:
+  static InputParameters validParams();
+
+  NestedBoundaryBC(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual();
+  virtual Real computeQpJacobian();
+
+  /// Velocity and diffusivity supplied by the materials system.
+  const MaterialProperty<RealVectorValue> & _velocity;
+  const MaterialProperty<RealTensorValue> & _diffusivity;
+
+  /// Concentration of the coarse domain along the boundary, and its gradient.
+  const VariableValue & _parent_concentration;
+  const VariableGradient & _grad_parent_concentration;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "ArrayIntegratedBC.h"
+
+/**
+ * Mass outflow of every component of an array variable (one component per
+ * species) using the velocity supplied by the materials system, and the
+ * settling velocity of each species, as MaterialOutflowBC does for a single
+ * species. Nothing enters the domain where the flow of a species is inward.
+ */
+class STArrayOutflowBC : public ArrayIntegratedBC
+{
+public:
+  static InputParameters validParams();
+
+  STArrayOutflowBC(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  /// Outward normal velocity of each species at the current quadrature point.
+  RealEigenVector outflowVelocity() const;
+
+  /// Velocity supplied by the materials system.
+  const MaterialProperty<RealVectorValue> & _velocity;
+
+  /// Settling velocity (z component) of each species.
+  RealEigenVector _settling_v;
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "DiracKernel.h"
+#include "WorkStatistics.h"
+
+#include <cstdint>
+
+// Forward declaration.
+class MultiPointSource;
+
+/**
+ * This kernel provides any number of point sources, each releasing material
+ * at a piecewise constant rate, read from a source table. A line or area
+ * source discretized into points, or several release locations, can be
+ * handled by a single kernel.
+ *
+ * The source table is either a pair of csv files (the point locations, and
+ * the release times followed by one rate column per point) or a binary
+ * source file (see python/source_table_utils.py). The active rates are
+ * located once per time step, and the elements containing the points are
+ * cached between time steps.
+ *
+ * The source table is recoverable: a recovered run continues with the table
+ * it was using, without reading the source files (which may have been
+ * updated since). A restarted run reads them again, such that updated release
+ * estimates can be swapped in.
+ */
+
+template <>
+InputParameters validParams<MultiPointSource>();
+
+class MultiPointSource : public DiracKernel
+{
+public:
+  MultiPointSource(const InputParameters & parameters);
+  virtual ~MultiPointSource();
+
+  /// Adds the points this kernels acts on.
+  virtual void addPoints() override;
+
+  /// Identifies the binary source table format.
+  static const char FILE_MAGIC[8];
+  static const std::uint32_t FILE_VERSION;
+
+protected:
+  virtual Real computeQpResidual() override;
+
+  /// Reads the source table from csv files.
+  void readCsv(const std::string & points_file, const std::string & rates_file);
+
+  /// Reads the source table from a binary source file.
+  void readBinary(const std::string & file_name);
+
+  /// Merges sources sharing a location, which the Dirac kernel system only
+  /// adds once, by summing their rates.
+  void mergeDuplicatePoints();
+
+  /// Locates the rates active at the current time.
+  void updateActiveRates();
+
+  /// Locations of the sources.
+  std::vector<Point> & _points;
+
+  /// Times at which the release rates change.
+  std::vector<Real> & _times;
+
+  /// Release rates of every source, indexed by [time index][source].
+  std::vector<Real> & _rates;
+
+  /// Rates of every source at the current time (nullptr before the first
+  /// release time).
+  const Real * _active_rates;
+
+  /// Time at which the active rates were located.
+  Real _rates_time;
+
+  /// Rate of the point currently being integrated.
+  Real _current_rate;
+
+  /// Point additions (and location of the uncached points) and their cost.
+  WorkCounter & _add_points_work;
+};
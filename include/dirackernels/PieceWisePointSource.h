@@ -36,4 +36,8 @@ class PieceWisePointSource;
    /// Libmesh point this kernel acts on.
    Point _point;
 
+   /// Time at which the active rate was located, and the active rate.
+   Real _rate_time;
+   Real _current_rate;
+
  };
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "DiracKernel.h"
+
+// Forward declaration.
+class UnitReleaseSource;
+
+/**
+ * This kernel releases a fixed amount of material (a unit release by default)
+ * at a point, uniformly over a release interval. The amount released in each
+ * time step is the fraction of the interval the step overlaps, such that the
+ * total is exact whatever the time steps.
+ *
+ * As transport is linear, the responses to unit releases from each source
+ * location and release interval can be scaled and summed to obtain the
+ * response to any release schedule (see python/superposition.py).
+ */
+
+template <>
+InputParameters validParams<UnitReleaseSource>();
+
+class UnitReleaseSource : public DiracKernel
+{
+public:
+  UnitReleaseSource(const InputParameters & parameters);
+
+  /// Adds the point this kernels acts on.
+  virtual void addPoints() override;
+
+protected:
+  virtual Real computeQpResidual() override;
+
+  /// Amount of material released over the interval.
+  const Real _amount;
+
+  /// Start and end of the release interval.
+  const Real _release_start;
+  const Real _release_end;
+
+  /// Point provided by the parameter system with 1 -> 3 coordinates.
+  std::vector<Real> _input_point;
+
+  /// Libmesh point this kernel acts on.
+  Point _point;
+
+  /// Time at which the release rate was computed, and the rate.
+  Real _rate_time;
+  Real _rate;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ElementIndicator.h"
+
+#include <unordered_map>
+
+/**
+ * Indicator which follows a plume. The value of an element is the largest
+ * concentration scale found at its quadrature points among:
+ *  - the concentration, |u|;
+ *  - the jump of the concentration across the element, h |grad u|.
+ * The value is in concentration units, and is meant to be thresholded by a
+ * PlumeMarker.
+ *
+ * With a look ahead time T, the indicator also records the path x - s T v
+ * (0 < s <= 1) the element centroid x was advected along by the mean
+ * material velocity v over the element. An element ahead of the plume has no
+ * concentration yet, the PlumeMarker refines it if any element its path
+ * crosses holds the plume.
+ */
+class PlumeIndicator : public ElementIndicator
+{
+public:
+  static InputParameters validParams();
+
+  PlumeIndicator(const InputParameters & parameters);
+
+  virtual void computeIndicator() override;
+
+  /// Whether the upstream path of the element was computed by this thread
+  /// copy of the indicator at the current time, and its end point x - T v.
+  bool upstreamPoint(const Elem * elem, Point & point) const;
+
+protected:
+  /// Time over which the plume is projected ahead (0 disables it).
+  const Real _look_ahead_time;
+
+  /// Advection velocity from the material system, when looking ahead.
+  const MaterialProperty<RealVectorValue> * _velocity;
+
+  /// Upstream path of an element: the time and centroid it was computed for
+  /// (the thread computing an element, and element ids, change between
+  /// adaptivity steps) and its end point.
+  struct UpstreamPath
+  {
+    Real time;
+    Point centroid;
+    Point end;
+  };
+
+  /// Upstream paths of the elements computed by this thread copy.
+  std::unordered_map<dof_id_type, UpstreamPath> _upstream_paths;
+};
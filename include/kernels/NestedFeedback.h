@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Kernel.h"
+
+// Forward Declaration.
+class NestedFeedback;
+
+/**
+ * Two-way nesting feedback of a fine (sub-application) domain on the coarse
+ * domain holding it. Relaxes the coarse concentration toward the fine
+ * concentration, conservatively projected on the coarse mesh, over a
+ * relaxation time. Restricted to the blocks covered by the fine domain.
+ *
+ * The relaxation is implicit: with the time step as relaxation time the coarse
+ * concentration moves about halfway toward the fine one every step (the
+ * average of the transported coarse value and the fine value), it is not
+ * replaced. The feedback is a source or sink of the coarse domain, its rate
+ * is given by NestedFeedbackRate.
+ */
+template <>
+InputParameters validParams<NestedFeedback>();
+
+class NestedFeedback : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  NestedFeedback(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  /// Relaxation rate, the inverse of the relaxation time (the time step if
+  /// none was provided).
+  Real relaxationRate() const;
+
+  /// Fine domain concentration projected on this mesh.
+  const VariableValue & _nested_concentration;
+
+  /// Whether a fixed relaxation time was provided.
+  const bool _fixed_relaxation;
+  const Real _relaxation_time;
+};
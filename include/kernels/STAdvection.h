@@ -19,13 +19,18 @@
 #pragma once
 
 #include "Kernel.h"
+#include "WorkStatistics.h"
+#include "libmesh/dense_matrix.h"
 
 // Forward Declaration.
 class STAdvection;
 
 /**
  * Advection of the variable by the velocity provided by the material system.
- * Options for numerical stabilization are: none; full upwinding.
+ * Options for numerical stabilization are: none; full upwinding; streamline
+ * upwind Petrov-Galerkin (SUPG); element-local algebraic flux correction.
+ * For the adjoint problem the divergence of the velocity is removed from the
+ * conservative form.
  */
 template <>
 InputParameters validParams<STAdvection>();
@@ -36,12 +41,23 @@ public:
   static InputParameters validParams();
 
   STAdvection(const InputParameters & parameters);
+  virtual ~STAdvection();
+
+  /// Whether the residual is linear in the variable (every upwinding type
+  /// except flux limiting).
+  bool linearInVariable() const { return _upwinding != UpwindingType::flux_limited; }
+
+  /// Checks that the SUPG residual includes the terms of the kernels acting
+  /// on the variable.
+  virtual void initialSetup() override;
 
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual void computeResidual() override;
   virtual void computeJacobian() override;
+  virtual void precalculateResidual() override;
+  virtual void precalculateJacobian() override;
 
   /// Advection velocity from the material system.
   const MaterialProperty<RealVectorValue> & _velocity;
@@ -54,7 +70,7 @@ protected:
   };
 
   /// Type of upwinding.
-  const enum class UpwindingType { none, full } _upwinding;
+  const enum class UpwindingType { none, full, supg, flux_limited } _upwinding;
 
   /// Nodal value of u, used for full upwinding.
   const VariableValue & _u_nodal;
@@ -70,4 +86,60 @@ protected:
 
   /// Calculates the fully-upwind Residual and Jacobian (depending on res_or_jac)
   void fullUpwind(JacRes res_or_jac);
+
+  /// Diffusion tensor from the material system, used for the SUPG element
+  /// Peclet number.
+  const MaterialProperty<RealTensorValue> * _diffusivity;
+
+  /// Whether the time derivative is included in the SUPG residual.
+  const bool _supg_time_derivative;
+
+  /// Decay constant, settling velocity and scavenging coefficient of the
+  /// terms included in the SUPG residual (null when not included).
+  const MaterialProperty<Real> * _decay_const;
+  const MaterialProperty<Real> * _settling_v;
+  const MaterialProperty<Real> * _scavenge_const;
+
+  /// Returns the loss coefficient (decay and wet deposition) included in the
+  /// SUPG residual.
+  Real lossQp() const;
+
+  /// SUPG stabilization parameter at each quadrature point of the element.
+  std::vector<Real> _tau;
+
+  /// Computes the SUPG stabilization parameter at the quadrature points.
+  void computeTau();
+
+  /// Galerkin element matrix of the advection operator (flux limiting).
+  DenseMatrix<Number> _elem_matrix;
+
+  /// Artificial diffusion coefficients of the low order operator (flux
+  /// limiting).
+  DenseMatrix<Number> _artificial_diffusion;
+
+  /// Nodal values, residuals and perturbed copies used for flux limiting.
+  std::vector<Real> _u_local;
+  std::vector<Real> _u_perturbed;
+  std::vector<Real> _re_local;
+  std::vector<Real> _re_perturbed;
+
+  /// Computes the flux limited residual of the element for the nodal values u.
+  void limitedResidual(const std::vector<Real> & u, std::vector<Real> & re) const;
+
+  /// Calculates the flux limited Residual and Jacobian (depending on
+  /// res_or_jac). The Jacobian is computed by finite differences of the
+  /// element residual, as the limiter is not differentiable.
+  void fluxLimited(JacRes res_or_jac);
+
+  /// Divergence of the velocity, removed from the advective term of the
+  /// adjoint problem (null for the forward problem).
+  const MaterialProperty<Real> * _velocity_divergence;
+
+  /// Adds the divergence term of the adjoint problem to the local Residual or
+  /// Jacobian (depending on res_or_jac), for the element loops of the kernel.
+  void removeDivergence(JacRes res_or_jac);
+
+  /// Residual and Jacobian evaluations (elements) and their cost.
+  WorkCounter & _residual_work;
+  WorkCounter & _jacobian_work;
 };
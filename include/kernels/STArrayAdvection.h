@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ArrayKernel.h"
+
+/**
+ * Advection of every component of an array variable (one component per
+ * species) by the velocity provided by the material system, with an optional
+ * settling velocity for each species. The velocity is evaluated once per
+ * quadrature point for all species. Options for numerical stabilization are:
+ * none; full upwinding, as in STAdvection, applied to each species with its
+ * own settling velocity. For the adjoint problem the divergence of the
+ * velocity is removed from the conservative form.
+ */
+class STArrayAdvection : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+
+  STArrayAdvection(const InputParameters & parameters);
+
+protected:
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void initQpResidual() override;
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  /// Advection velocity from the material system.
+  const MaterialProperty<RealVectorValue> & _velocity;
+
+  /// Type of upwinding.
+  const enum class UpwindingType { none, full } _upwinding;
+
+  /// Nodal values of the species, used for full upwinding.
+  const MooseArray<RealEigenVector> & _u_nodal;
+
+  /// Settling velocity (z component) of each species.
+  RealEigenVector _settling_v;
+
+  /// Whether any species settles.
+  bool _has_settling;
+
+  /// Settling velocity times the species concentrations at the current
+  /// quadrature point.
+  RealEigenVector _settling_u;
+
+  /// Divergence of the velocity, removed from the advective term of the
+  /// adjoint problem (null for the forward problem).
+  const MaterialProperty<Real> * _velocity_divergence;
+
+  /// Enum to make the code clearer.
+  enum class JacRes
+  {
+    CALCULATE_RESIDUAL = 0,
+    CALCULATE_JACOBIAN = 1
+  };
+
+  /// In the full-upwind scheme, the outflow of each species from each node
+  /// per unit concentration, and the outflow and inflow totals of the
+  /// element.
+  std::vector<RealEigenVector> _node_outflow;
+  RealEigenVector _total_mass_out;
+  RealEigenVector _total_in;
+
+  /// Calculates the fully-upwind Residual and Jacobian (depending on
+  /// res_or_jac) of every species.
+  void fullUpwind(JacRes res_or_jac);
+};
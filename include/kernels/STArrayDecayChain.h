@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ArrayKernel.h"
+
+/**
+ * Radioactive decay and ingrowth (the Bateman equations) for an array
+ * variable holding the concentrations of the members of one or more decay
+ * chains. Species k decays with constant lambda_k, and each decay link
+ * transfers a branching fraction of the decays of its parent to its
+ * daughter:
+ *
+ *   r_k = psi_i (lambda_k u_k - sum_{p -> k} f_pk lambda_p u_p)
+ *
+ * The coupling between species is assembled into the full block Jacobian,
+ * which requires the off diagonal blocks of the array variable to be
+ * preconditioned (e.g. SMP with full = true).
+ */
+class STArrayDecayChain : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+
+  STArrayDecayChain(const InputParameters & parameters);
+
+protected:
+  virtual void initQpResidual() override;
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  /// A parent to daughter decay link.
+  struct DecayLink
+  {
+    unsigned int parent;
+    unsigned int daughter;
+    /// Branching fraction times the decay constant of the parent.
+    Real rate;
+  };
+
+  /// Decay constant of each species.
+  RealEigenVector _decay_const;
+
+  /// Parent to daughter links of the decay chains.
+  std::vector<DecayLink> _links;
+
+  /// Decay matrix (diagonal decay minus ingrowth), used for the Jacobian.
+  RealEigenMatrix _decay_matrix;
+
+  /// Net decay rate of each species at the current quadrature point.
+  RealEigenVector _net_decay;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ArrayKernel.h"
+
+/**
+ * Diffusion of every component of an array variable (one component per
+ * species) with the diffusion tensor provided by the material system. The
+ * tensor is shared by all species, as for turbulent (eddy) diffusion.
+ */
+class STArrayDiffusion : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+
+  STArrayDiffusion(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  /// Diffusion tensor provided by the material system.
+  const MaterialProperty<RealTensorValue> & _diffusivity;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ArrayKernel.h"
+
+/**
+ * Wet deposition of every component of an array variable (one component per
+ * species), as SpeciesWetDeposition does for a single species: a sink with
+ * the scavenging coefficient provided by the material system, scaled by a
+ * factor for each species (e.g. zero for noble gases).
+ */
+class STArrayWetDeposition : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+
+  STArrayWetDeposition(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  /// Wet scavenging coefficient provided by the material system.
+  const MaterialProperty<Real> & _scavenge_const;
+
+  /// Scavenging factor of each species.
+  RealEigenVector _factors;
+};
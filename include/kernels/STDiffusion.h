@@ -1,14 +1,14 @@
 #pragma once
 
 #include "Diffusion.h"
+#include "WorkStatistics.h"
 
 // Forward Declaration
 class STDiffusion;
 
 /**
  * Diffusion of the variable implemented by the Diffusion kernel (part of the
- * MOOSE framework), with a diffusion coefficient provided by the material
- * system.
+ * MOOSE framework), with a diffusion tensor provided by the material system.
  */
 
 template <>
@@ -20,11 +20,53 @@ public:
   static InputParameters validParams();
 
   STDiffusion(const InputParameters & parameters);
+  virtual ~STDiffusion();
 
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
 
-  /// Diffusion coefficient provided by the material system.
-  const MaterialProperty<std::vector<Real>> & _diffusivity;
+  /// Computes a . (K b) over the first dim components of the vectors.
+  template <unsigned int dim>
+  static Real contract(const RealTensorValue & K,
+                       const RealVectorValue & a,
+                       const RealVectorValue & b);
+
+  /// Residual and Jacobian element loops for the dimension of the mesh, in
+  /// which the contraction is inlined.
+  template <unsigned int dim>
+  void residualLoop();
+
+  template <unsigned int dim>
+  void jacobianLoop();
+
+  /// Diffusion tensor provided by the material system.
+  const MaterialProperty<RealTensorValue> & _diffusivity;
+
+  /// Residual and Jacobian evaluations (elements) and their cost.
+  WorkCounter & _residual_work;
+  WorkCounter & _jacobian_work;
+
+  /// Dimension of the mesh.
+  const unsigned int _dim;
 };
+
+template <unsigned int dim>
+Real
+STDiffusion::contract(const RealTensorValue & K,
+                      const RealVectorValue & a,
+                      const RealVectorValue & b)
+{
+  Real result = 0.0;
+  for (unsigned int i = 0; i < dim; i++)
+  {
+    Real Kb = 0.0;
+    for (unsigned int j = 0; j < dim; j++)
+      Kb += K(i, j) * b(j);
+    result += a(i) * Kb;
+  }
+
+  return result;
+}
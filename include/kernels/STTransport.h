@@ -0,0 +1,267 @@
+#pragma once
+
+#include "Kernel.h"
+#include "WorkStatistics.h"
+
+// Forward Declaration.
+class STTransport;
+
+/**
+ * Atmospheric transport of the variable in a single kernel: the advection
+ * (STAdvection without upwinding), diffusion (STDiffusion), radioactive decay
+ * (SpeciesDecay), settling (SpeciesSettling) and wet deposition
+ * (SpeciesWetDeposition) terms, each of which can be enabled individually.
+ * For the adjoint problem the divergence of the velocity is removed from the
+ * advective term.
+ *
+ * The advective flux, diffusive flux and loss rate (for the Jacobian, the
+ * velocity and loss coefficient) are combined once per quadrature point,
+ * and the residual and Jacobian element loops are
+ * specialized at compile time on the mesh dimension and on the enabled terms.
+ * The specialization is selected at construction and dispatched once per
+ * element, the quadrature point terms are inlined in the loops. The generic
+ * Kernel quadrature point methods are not used.
+ */
+template <>
+InputParameters validParams<STTransport>();
+
+class STTransport : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  STTransport(const InputParameters & parameters);
+  virtual ~STTransport();
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+
+  /// Combines the enabled terms at every quadrature point of the element.
+  template <unsigned int dim, bool advective, bool diffusive, bool loss>
+  void precalculateQp();
+
+  /// Combines the coefficients of the enabled terms (velocity and loss
+  /// coefficient) at every quadrature point of the element, for the Jacobian.
+  template <bool advective, bool loss>
+  void precalculateJacobianQp();
+
+  template <unsigned int dim, bool advective, bool diffusive, bool loss>
+  Real qpResidual();
+
+  template <unsigned int dim, bool advective, bool diffusive, bool loss>
+  Real qpJacobian();
+
+  /// Residual and Jacobian element loops.
+  template <unsigned int dim, bool advective, bool diffusive, bool loss>
+  void residualLoop();
+
+  template <unsigned int dim, bool advective, bool diffusive, bool loss>
+  void jacobianLoop();
+
+  /// Selects the specialization for the enabled terms.
+  template <unsigned int dim>
+  void selectTerms(bool advective, bool diffusive, bool loss);
+
+  template <unsigned int dim, bool advective, bool diffusive, bool loss>
+  void assignTerms();
+
+  /// Dot product over the first dim components.
+  template <unsigned int dim>
+  static Real dot(const RealVectorValue & a, const RealVectorValue & b);
+
+  /// Product of a tensor and a vector over the first dim components.
+  template <unsigned int dim>
+  static RealVectorValue product(const RealTensorValue & K, const RealVectorValue & b);
+
+  /// Terms included in the kernel.
+  const bool _advection;
+  const bool _diffusion;
+  const bool _decay;
+  const bool _settling;
+  const bool _wet_deposition;
+
+  /// Material properties of the enabled terms.
+  const MaterialProperty<RealVectorValue> * _velocity;
+  const MaterialProperty<RealTensorValue> * _diffusivity;
+  const MaterialProperty<Real> * _decay_const;
+  const MaterialProperty<Real> * _settling_v;
+  const MaterialProperty<Real> * _scavenge_const;
+  const MaterialProperty<Real> * _velocity_divergence;
+
+  /// Negative of the advective velocity (material velocity and settling
+  /// velocity) at each quadrature point.
+  std::vector<RealVectorValue> _neg_velocity;
+
+  /// Total flux (advective and diffusive) at each quadrature point.
+  std::vector<RealVectorValue> _flux;
+
+  /// Loss coefficient (decay, wet deposition and the divergence of the
+  /// adjoint velocity) and loss rate at each quadrature point.
+  std::vector<Real> _loss_coeff;
+  std::vector<Real> _loss;
+
+  /// Specializations for the mesh dimension and enabled terms.
+  void (STTransport::*_residual_loop)();
+  void (STTransport::*_jacobian_loop)();
+
+  /// Residual and Jacobian evaluations (elements) and their cost.
+  WorkCounter & _residual_work;
+  WorkCounter & _jacobian_work;
+};
+
+template <unsigned int dim>
+Real
+STTransport::dot(const RealVectorValue & a, const RealVectorValue & b)
+{
+  Real result = 0.0;
+  for (unsigned int i = 0; i < dim; i++)
+    result += a(i) * b(i);
+
+  return result;
+}
+
+template <unsigned int dim>
+RealVectorValue
+STTransport::product(const RealTensorValue & K, const RealVectorValue & b)
+{
+  RealVectorValue result;
+  for (unsigned int i = 0; i < dim; i++)
+    for (unsigned int j = 0; j < dim; j++)
+      result(i) += K(i, j) * b(j);
+
+  return result;
+}
+
+template <unsigned int dim, bool advective, bool diffusive, bool loss>
+void
+STTransport::precalculateQp()
+{
+  /// The velocity and loss coefficient are those of the Jacobian.
+  precalculateJacobianQp<advective, loss>();
+
+  const unsigned int n_qp = _qrule->n_points();
+  _flux.resize(n_qp);
+  _loss.resize(n_qp);
+
+  for (unsigned int qp = 0; qp < n_qp; qp++)
+  {
+    RealVectorValue flux;
+    if (advective)
+      flux = _neg_velocity[qp] * _u[qp];
+    if (diffusive)
+      flux += product<dim>((*_diffusivity)[qp], _grad_u[qp]);
+
+    _flux[qp] = flux;
+
+    if (loss)
+      _loss[qp] = _loss_coeff[qp] * _u[qp];
+  }
+}
+
+template <bool advective, bool loss>
+void
+STTransport::precalculateJacobianQp()
+{
+  const unsigned int n_qp = _qrule->n_points();
+  _neg_velocity.resize(n_qp);
+  _loss_coeff.resize(n_qp);
+
+  for (unsigned int qp = 0; qp < n_qp; qp++)
+  {
+    if (advective)
+    {
+      RealVectorValue velocity;
+      if (_advection)
+        velocity = (*_velocity)[qp];
+      if (_settling)
+        velocity(2) += (*_settling_v)[qp];
+
+      _neg_velocity[qp] = -velocity;
+    }
+
+    if (loss)
+    {
+      Real coeff = 0.0;
+      if (_decay)
+        coeff += (*_decay_const)[qp];
+      if (_wet_deposition)
+        coeff += (*_scavenge_const)[qp];
+      if (_velocity_divergence)
+        coeff -= (*_velocity_divergence)[qp];
+
+      _loss_coeff[qp] = coeff;
+    }
+  }
+}
+
+template <unsigned int dim, bool advective, bool diffusive, bool loss>
+Real
+STTransport::qpResidual()
+{
+  Real residual = dot<dim>(_grad_test[_i][_qp], _flux[_qp]);
+  if (loss)
+    residual += _test[_i][_qp] * _loss[_qp];
+
+  return residual;
+}
+
+template <unsigned int dim, bool advective, bool diffusive, bool loss>
+Real
+STTransport::qpJacobian()
+{
+  RealVectorValue flux;
+  if (advective)
+    flux = _neg_velocity[_qp] * _phi[_j][_qp];
+  if (diffusive)
+    flux += product<dim>((*_diffusivity)[_qp], _grad_phi[_j][_qp]);
+
+  Real jacobian = dot<dim>(_grad_test[_i][_qp], flux);
+  if (loss)
+    jacobian += _test[_i][_qp] * _loss_coeff[_qp] * _phi[_j][_qp];
+
+  return jacobian;
+}
+
+template <unsigned int dim, bool advective, bool diffusive, bool loss>
+void
+STTransport::assignTerms()
+{
+  _residual_loop = &STTransport::residualLoop<dim, advective, diffusive, loss>;
+  _jacobian_loop = &STTransport::jacobianLoop<dim, advective, diffusive, loss>;
+}
+
+template <unsigned int dim>
+void
+STTransport::selectTerms(bool advective, bool diffusive, bool loss)
+{
+  switch ((advective ? 4 : 0) + (diffusive ? 2 : 0) + (loss ? 1 : 0))
+  {
+    case 0:
+      assignTerms<dim, false, false, false>();
+      break;
+    case 1:
+      assignTerms<dim, false, false, true>();
+      break;
+    case 2:
+      assignTerms<dim, false, true, false>();
+      break;
+    case 3:
+      assignTerms<dim, false, true, true>();
+      break;
+    case 4:
+      assignTerms<dim, true, false, false>();
+      break;
+    case 5:
+      assignTerms<dim, true, false, true>();
+      break;
+    case 6:
+      assignTerms<dim, true, true, false>();
+      break;
+    default:
+      assignTerms<dim, true, true, true>();
+      break;
+  }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "IndicatorMarker.h"
+
+#include "libmesh/point_locator_base.h"
+
+class PlumeIndicator;
+
+/**
+ * Marks elements for refinement where a PlumeIndicator exceeds a threshold
+ * and for coarsening where it falls below a lower one, such that the mesh
+ * follows the plume and coarsens behind it. Elements near the active point
+ * sources are always refined.
+ *
+ * When the indicator looks ahead, elements are also refined if the plume
+ * (indicator above the refinement threshold) is found along their upstream
+ * path, i.e. in the region the wind sweeps into them within the look ahead
+ * time. The path is followed on the elements of this process (the whole mesh
+ * unless it is distributed).
+ */
+class PlumeMarker : public IndicatorMarker
+{
+public:
+  static InputParameters validParams();
+
+  PlumeMarker(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+protected:
+  virtual MarkerValue computeElementMarker() override;
+
+  /// Whether the plume is found along the path from the centroid of the
+  /// current element to end.
+  bool plumeUpstream(const Point & end) const;
+
+  /// Indicator values above which elements are refined, and below which
+  /// they are coarsened.
+  const Real _refine;
+  const Real _coarsen;
+
+  /// Point sources around which the mesh is kept refined.
+  std::vector<Point> _source_points;
+
+  /// Radius of the refined region around each source.
+  const Real _source_radius;
+
+  /// Time after which the sources no longer force refinement.
+  const Real _source_end_time;
+
+  /// Thread copies of the indicator, if it is a PlumeIndicator looking ahead.
+  std::vector<const PlumeIndicator *> _plume_indicators;
+
+  /// Locates the elements along the upstream paths.
+  std::unique_ptr<PointLocatorBase> _locator;
+};
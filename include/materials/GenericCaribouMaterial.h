@@ -29,4 +29,9 @@ protected:
 
   /// Wet scavenging coefficient this material is providing.
   MaterialProperty<Real> & _wet_scavenge;
+
+  /// Constants read from the input parameters at construction.
+  const Real _decay_const_value;
+  const Real _settling_v_value;
+  const Real _wet_scavenge_value;
 };
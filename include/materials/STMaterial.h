@@ -1,16 +1,35 @@
 #pragma once
 
 #include "Material.h"
-#include "TrilinearInterpolation.h"
+#include "WindField.h"
+#include "WorkStatistics.h"
 
-// Forward declaration.
+#include <cstdint>
+#include <unordered_map>
+
+// Forward declarations.
 class STMaterial;
+class Function;
 
 /**
  * A generic scalar transport material which provides a velocity profile and
  * diffusion coefficient for advection-diffusion. Can accept velocity values
- * from a properly formatted series of input csv files or as a constant provided
- * by the InputParameters system.
+ * from a properly formatted series of input csv files, a binary wind field
+ * file, a NetCDF meteorological file or as a constant provided by the
+ * InputParameters system.
+ *
+ * In adjoint mode the material provides the properties of the backward
+ * problem: the reversed velocity, read from the wind field at time T - t,
+ * its divergence and the transposed diffusion tensor. The adjoint of the
+ * transport problem is then solved forward in time t by the same outflow
+ * boundary conditions and by the advection kernels in adjoint mode, which
+ * remove the divergence from the conservative advective term.
+ *
+ * The time bracket of the wind field is restartable. The wind data read from
+ * csv or meteorological files can be kept in a binary snapshot which is
+ * mapped on restart instead of parsing the files again. A run may be
+ * restarted with another wind data set (e.g. an updated forecast, offset to
+ * its issue time), in which case the time bracket is located again.
  */
 
 template <>
@@ -20,56 +39,46 @@ class STMaterial : public Material
 {
 public:
    STMaterial(const InputParameters & parameters);
+   virtual ~STMaterial();
+
+  /// Resumes the time bracket restored from a checkpoint.
+  virtual void initialSetup() override;
+
+  /// Drops the cached velocities, which are indexed by element.
+  virtual void meshChanged() override;
+
+  /// Whether the properties entering the transport operator (velocity and
+  /// diffusivity) may differ between times t_old and t.
+  bool operatorChanged(Real t_old, Real t) const;
 
 protected:
+  /// Method to update the time bracket of the velocity field relative to the
+  /// current simulation time. Only performs work once per time step.
+  void updateTimeIndex();
 
-  /// Method to initialize 2D trilinear interpolators to interpolate velocity
-  /// components from the given csv files.
-  void twoDConstruct(std::string & _delimiter,
-                     std::vector<std::string> & _file_names);
-
-  /// Method to initialize 3D trilinear interpolators to interpolate velocity
-  /// components from the given csv files.
-  void threeDConstruct(std::string & _delimiter,
-                       std::vector<std::string> & _file_names);
-  /// Method to compute the time index of the data relative to the current
-  /// simulation time.
-  void computeTimeIndex();
-
-  /// Methods to update the interpolator objects when the velocity field is time
-  /// dependant. This is computationally taxing and should be replaced
-  /// with a quadrilinear interpolation scheme in the future.
-  void twoDUpdate();
-  void threeDUpdate();
-
-  /// Method to remove irrelevent datapoints from the data read from the csv
-  /// files.
-  void cleanAxisData(std::vector<Real> & _array_to_clean);
-
-  /// Main property compute method. Calls either twoDComputeQpProperties or
-  /// threeDComputeQpProperties depending on the number of dimensions.
+  /// Main property compute method.
   virtual void computeQpProperties() override;
 
-  /// Property compute method for 2D.
-  virtual void twoDComputeQpProperties();
+  /// Returns the cached velocity at the current quadrature point, sampling
+  /// every quadrature point of the element at once on the first one.
+  const RealVectorValue & cachedVelocity();
 
-  /// Property compute method for 3D.
-  virtual void threeDComputeQpProperties();
+  /// Samples the velocity at the n_qp quadrature points of the current
+  /// element into _velocity_cache, starting at offset.
+  void sampleVelocity(unsigned int n_qp, std::size_t offset);
 
-  /// Vectors of values for the data axis.
-  std::vector<std::vector<Real>> _dimensions;
+  /// Time of the wind field at simulation time t (reversed for the adjoint
+  /// problem).
+  Real windTime(Real t) const;
 
-  /// Vectors of values for the data names.
-  std::vector<std::vector<std::string>> _data_names;
+  /// Drops every cached element velocity.
+  void clearVelocityCache();
 
-  ///Vectors of values for the data.
-  std::vector<std::vector<Real>> _u_data;
-  std::vector<std::vector<Real>> _v_data;
-  std::vector<std::vector<Real>> _w_data;
+  /// Velocity data shared by every material reading the same files.
+  std::shared_ptr<WindField> _wind;
 
-  /// Vectors of interpolator objects to interpolate data.
-  std::vector<TrilinearInterpolation> _2_d_interp;
-  std::vector<TrilinearInterpolation> _3_d_interp;
+  /// Quadrilinear interpolator for the velocity components.
+  std::unique_ptr<SpaceTimeInterpolation> _interp;
 
   /// Boolean variables to clean up the code somewhat.
   bool _velocity_time_dependant;
@@ -78,18 +87,74 @@ protected:
   /// Number of dimensions in the mesh.
   unsigned _num_dims;
 
-  /// Current index entry of the time dependant velocity field and the previous
-  /// index entry.
-  unsigned _t_index;
-  unsigned _previous_t_index;
+  /// Whether the velocity field is blended linearly between data times.
+  const bool _linear_in_time;
+
+  /// Current index entries of the time dependant velocity field (lower and
+  /// upper ends of the time bracket).
+  unsigned & _t_index;
+  unsigned & _t_upper_index;
 
   /// Old simulation time. Used to detect if the simulation has advanced in a
   /// time step.
-  Real _old_time;
+  Real & _old_time;
+
+  /// Fingerprint of the wind data the time bracket indexes.
+  std::uint64_t & _wind_fingerprint;
+
+  /// Simulation time at which the wind data time axis starts.
+  const Real _wind_time_offset;
+
+  /// Element velocity cache entry: location of the quadrature point
+  /// velocities in _velocity_cache, and the quadrature points they were
+  /// sampled at (used to detect other points in the same element).
+  struct VelocityCacheEntry
+  {
+    std::size_t offset;
+    unsigned int n_qp;
+    Point first_qp;
+  };
+
+  /// Whether the quadrature point velocities are cached per element.
+  const bool _cache_velocity;
+
+  /// Cached quadrature point velocities, indexed by element, side (for
+  /// boundary materials) and number of points. Valid for the current time
+  /// bracket and weight, and until the mesh changes.
+  std::unordered_map<std::uint64_t, VelocityCacheEntry> _velocity_cache_index;
+  std::vector<RealVectorValue> _velocity_cache;
+
+  /// Offset of the current element's velocities in _velocity_cache.
+  std::size_t _cache_offset;
+
+  /// Constant velocity, if one was provided.
+  RealVectorValue _const_velocity;
+
+  /// Diffusion tensor built from the input parameters.
+  RealTensorValue _diffusivity_tensor;
+
+  /// Optional profile of the vertical diffusion coefficient.
+  const Function * _vertical_diffusivity;
+
+  /// Whether the properties of the adjoint problem are provided, and the
+  /// final time of the forward problem.
+  const bool _adjoint;
+  Real _adjoint_final_time;
+
+  /// Divergence of the reversed velocity (adjoint problem only).
+  MaterialProperty<Real> * _velocity_divergence;
 
   /// Diffusion coefficient which this material is providing.
-  MaterialProperty<std::vector<Real>> & _diffusivity;
+  MaterialProperty<RealTensorValue> & _diffusivity;
 
   /// Velocity profile which this material is supplying.
   MaterialProperty<RealVectorValue> & _velocity;
+
+  /// Work counters: reading (or sharing) the wind data, time bracket updates
+  /// (slabs attached to the interpolator), velocity samples and cached
+  /// velocities served.
+  WorkCounter & _ingestion_work;
+  WorkCounter & _bracket_work;
+  WorkCounter & _sample_work;
+  WorkCounter & _cache_work;
 };
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "SideIntegralVariablePostprocessor.h"
+
+/**
+ * Rate at which a species is deposited on a boundary by dry deposition: the
+ * integral of v_d c over the boundary, and of the settling flux leaving
+ * through it. Its time integral (ImplicitTimeIntegral) is the deposited
+ * inventory.
+ */
+class DryDepositionRate : public SideIntegralVariablePostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  DryDepositionRate(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpIntegral() override;
+
+  /// Dry deposition velocity used by DryDepositionBC.
+  const Real _dry_deposition_velocity;
+
+  /// Settling velocity (z component) used by DryDepositionBC.
+  const Real _settling_velocity;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/**
+ * Time integral of a rate since the start of the run, using the rate at the
+ * end of each time step. This is the amount exchanged by implicit (backward
+ * Euler) terms, such as the deposition rates (DryDepositionRate,
+ * WetDepositionRate) matching the ground deposits of DryDepositionAux and
+ * WetDepositionColumn, or the nesting exchanges (NestedFeedbackRate,
+ * NestedBoundaryFlux). The trapezoidal TimeIntegratedPostprocessor differs by
+ * a term of order dt.
+ */
+class ImplicitTimeIntegral : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  ImplicitTimeIntegral(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// Rate at the end of the time step.
+  const PostprocessorValue & _rate;
+
+  /// Time integral, and the time it was last accumulated at.
+  Real & _integral;
+  Real & _integral_time;
+};
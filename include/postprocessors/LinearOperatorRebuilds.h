@@ -0,0 +1,24 @@
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class LinearOperatorReuse;
+
+/**
+ * Number of time steps which rebuilt the Jacobian and preconditioner under a
+ * LinearOperatorReuse, the other steps reused them.
+ */
+class LinearOperatorRebuilds : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  LinearOperatorRebuilds(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  const LinearOperatorReuse & _reuse;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "SideIntegralVariablePostprocessor.h"
+
+/**
+ * Net rate at which mass leaves a nested domain through its boundary: the
+ * integral of the advective and diffusive flux applied by NestedBoundaryBC.
+ * Its time integral (ImplicitTimeIntegral) is the mass exported to the coarse
+ * domain.
+ */
+class NestedBoundaryFlux : public SideIntegralVariablePostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  NestedBoundaryFlux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpIntegral() override;
+
+  /// Velocity and diffusivity supplied by the materials system.
+  const MaterialProperty<RealVectorValue> & _velocity;
+  const MaterialProperty<RealTensorValue> & _diffusivity;
+
+  /// Concentration of the coarse domain along the boundary, and its gradient.
+  const VariableValue & _parent_concentration;
+  const VariableGradient & _grad_parent_concentration;
+};
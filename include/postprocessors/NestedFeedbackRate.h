@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ElementIntegralVariablePostprocessor.h"
+
+/**
+ * Rate at which NestedFeedback adds mass to the coarse domain: the integral
+ * of the relaxation source, (nested - c) / relaxation time, over the blocks
+ * covered by the fine domain. Its time integral (ImplicitTimeIntegral) is the
+ * mass created (or destroyed, if negative) by the feedback.
+ */
+class NestedFeedbackRate : public ElementIntegralVariablePostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  NestedFeedbackRate(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpIntegral() override;
+
+  /// Fine domain concentration projected on this mesh.
+  const VariableValue & _nested_concentration;
+
+  /// Whether a fixed relaxation time was provided (as for NestedFeedback).
+  const bool _fixed_relaxation;
+  const Real _relaxation_time;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ElementIntegralVariablePostprocessor.h"
+
+/**
+ * Rate at which a species is removed by wet deposition: the integral of the
+ * wet scavenging sink (the scavenging coefficient from the materials system
+ * times the concentration) over the domain. Its time integral
+ * (ImplicitTimeIntegral) is the deposited inventory.
+ */
+class WetDepositionRate : public ElementIntegralVariablePostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  WetDepositionRate(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpIntegral() override;
+
+  /// Wet scavenging coefficient provided by the material system.
+  const MaterialProperty<Real> & _scavenge_const;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/**
+ * Number of bytes of wind field data (velocity slabs read from csv,
+ * meteorological or streamed binary files, and widened float32 slabs) held
+ * in memory, summed over processes. Mapped binary wind field files are
+ * excluded, their pages belong to the page cache shared by the processes of a
+ * node.
+ */
+class WindFieldMemory : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  WindFieldMemory(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() override;
+};
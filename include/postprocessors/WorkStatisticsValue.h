@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GeneralPostprocessor.h"
+#include "WorkStatistics.h"
+
+/**
+ * Reports a counter of the CARIBOU hot paths (see WorkStatistics) of this
+ * application: the number of calls or of items processed, summed over threads
+ * and processes, or the time spent, summed over threads and maximum over
+ * processes (as in PerformanceReport). Either accumulated over the run or
+ * over the last time step, and optionally per active element (e.g. the number
+ * of residual evaluations of a kernel). Counters are named after the object updating
+ * them, e.g. "wind::velocitySample" or "transport::residual".
+ */
+class WorkStatisticsValue : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  WorkStatisticsValue(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// Name of the counter reported.
+  const std::string _counter;
+
+  /// Quantity reported.
+  const enum class Quantity { calls, items, time } _quantity;
+
+  /// Whether the change over the last time step is reported.
+  const bool _per_step;
+
+  /// Whether the quantity is divided by the number of active elements.
+  const bool _per_element;
+
+  /// Value of the quantity at the last and current execution.
+  Real _previous;
+  Real _current;
+};
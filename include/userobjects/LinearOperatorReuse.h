@@ -0,0 +1,61 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+class STMaterial;
+
+/**
+ * Reuses the Jacobian and preconditioner of a linear transport problem across
+ * time steps while the transport operator is unchanged: the time step is
+ * constant, the mesh has not changed and the velocity of the STMaterials
+ * listed is the same (same wind data time, and no blending in time). The
+ * operator is rebuilt once on the first Newton iteration of any other time
+ * step. Executed at the beginning of each time step, it sets the lag of the
+ * PETSc SNES Jacobian and preconditioner accordingly.
+ *
+ * Intended for solve_type = NEWTON, where the problem converges in a single
+ * Newton iteration with the stored Jacobian. Only the residual (sources and
+ * time derivative) is assembled on the other steps. The residual must be
+ * linear in the variables: flux limited advection is rejected. The time
+ * derivative coefficient must only depend on the time step: only implicit
+ * Euler is accepted (BDF2 starts with an implicit Euler step).
+ */
+class LinearOperatorReuse : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  LinearOperatorReuse(const InputParameters & parameters);
+
+  /// Checks that the transport operator is linear and that the time
+  /// integrator is single step.
+  virtual void initialSetup() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  virtual void meshChanged() override;
+
+  /// Number of time steps which rebuilt the operator.
+  unsigned int rebuilds() const { return _rebuilds; }
+
+protected:
+  /// Whether the operator may differ from the one used by the last step.
+  bool operatorChanged() const;
+
+  /// Materials providing the velocity and diffusivity.
+  std::vector<const STMaterial *> _materials;
+
+  /// Time step of the last operator build.
+  Real _dt_built;
+
+  /// Whether the mesh changed since the last operator build.
+  bool _mesh_changed;
+
+  /// Whether an operator was built.
+  bool _built;
+
+  /// Number of time steps which rebuilt the operator.
+  unsigned int _rebuilds;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "WorkStatistics.h"
+
+#include <fstream>
+
+/**
+ * Prints, at the end of every time step, the work done by the CARIBOU hot
+ * paths (see WorkStatistics): the calls, items processed and time of every
+ * counter over the step and since the beginning of the run, the wind field
+ * memory and the values of a set of postprocessors (e.g. PerfGraphData
+ * timings of the solve or output). Optionally appends the same data to a csv
+ * file in long format, one row per counter and step.
+ *
+ * Only the counters of this application are reported. Enables the timing of
+ * the instrumented scopes. Calls and items are summed over processes, and the
+ * time is the maximum over processes.
+ */
+class PerformanceReport : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  PerformanceReport(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Counters reported, their totals at the last report, and the values of
+  /// the postprocessors reported.
+  const std::vector<std::string> _counters;
+  std::map<std::string, WorkCounter> _previous;
+  const std::vector<PostprocessorName> _pp_names;
+  std::vector<const PostprocessorValue *> _pp_values;
+
+  /// Whether the report is written to a csv file, and the file.
+  const bool _write_file;
+  std::ofstream _file;
+};
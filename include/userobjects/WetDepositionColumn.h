@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ElementUserObject.h"
+
+/**
+ * Accumulates the amount deposited on the ground per unit area by wet
+ * deposition. The wet scavenging sink (the scavenging coefficient from the
+ * materials system times the concentration) is integrated over vertical
+ * columns, binned on a regular horizontal grid covering the mesh, and added
+ * to the deposit every time step. Uses the concentration at the end of each
+ * time step, consistently with the implicit SpeciesWetDeposition kernel.
+ *
+ * The deposit can be mapped onto an auxiliary field with
+ * SpatialUserObjectAux. The deposit is constant over each column, so the
+ * field should be elemental (CONSTANT MONOMIAL, sampled at the element
+ * centroids): nodes on the edges between columns take the value of one of
+ * them, and a nodal field does not integrate to the deposited amount. For a
+ * 2D (horizontal) mesh, the columns reduce to the local sink averaged over
+ * each bin.
+ */
+class WetDepositionColumn : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  WetDepositionColumn(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  /// Deposited amount per unit area at the horizontal location of p. Points
+  /// on the edge between two columns belong to the upper one.
+  virtual Real spatialValue(const Point & p) const override;
+
+protected:
+  /// Index of the column containing the horizontal location of p.
+  unsigned int binIndex(const Point & p) const;
+
+  /// Concentration of the depositing species.
+  const VariableValue & _concentration;
+
+  /// Wet scavenging coefficient provided by the material system.
+  const MaterialProperty<Real> & _scavenge_const;
+
+  /// Horizontal grid of the columns.
+  const unsigned int _nx;
+  const unsigned int _ny;
+  Point _min;
+  Real _dx;
+  Real _dy;
+
+  /// Removal rate integrated over each column during this time step.
+  std::vector<Real> _column_rate;
+
+  /// Deposited amount per unit area of each column, and the time it was
+  /// last accumulated at.
+  std::vector<Real> & _deposit;
+  Real & _deposit_time;
+};
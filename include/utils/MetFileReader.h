@@ -0,0 +1,94 @@
+#pragma once
+
+#include "MooseTypes.h"
+
+/**
+ * Reads the wind on isobaric pressure levels from a NetCDF meteorological
+ * file (ERA5 pressure level or MERRA-2 assimilation products) directly into
+ * memory, replacing the python/Weather_format.py -> csv -> STMaterial
+ * pipeline.
+ *
+ * The file is subset to a latitude/longitude box and a set of pressure
+ * levels. The levels are converted to heights through the barometric formula
+ * (python/barometric_utils.py), the pressure velocity (omega, Pa/s) to a
+ * vertical velocity, and the latitude/longitude grid is projected to a local
+ * cartesian grid with its origin at the south west corner of the box: either
+ * through an equirectangular projection, or through fixed grid spacings as
+ * done by the python scripts.
+ *
+ * Velocity slabs are stored as [component][time][z][y][x] (the x index varies
+ * the fastest), with increasing axes. Time records are decoded by a pool of
+ * threads. The NetCDF library is not thread safe, so the reads themselves are
+ * serialized, and the unpacking, reordering and unit conversions of a record
+ * proceed while the next records are read.
+ *
+ * Only available if CARIBOU was built against NetCDF (see the Makefile). GRIB
+ * files can be converted with grib_to_netcdf (ecCodes) or requested as NetCDF
+ * from the climate data store.
+ */
+class MetFileReader
+{
+public:
+  /// Description of the data to extract.
+  struct Options
+  {
+    /// Names of the dimension variables.
+    std::string longitude = "longitude";
+    std::string latitude = "latitude";
+    std::string level = "level";
+    std::string time = "time";
+
+    /// Names of the u, v and pressure velocity variables.
+    std::vector<std::string> variables = {"u", "v", "w"};
+
+    /// Latitude and longitude box (in degrees, south/north and west/east).
+    Real lat_min = 0.0;
+    Real lat_max = 0.0;
+    Real lon_min = 0.0;
+    Real lon_max = 0.0;
+
+    /// Pressure levels to extract (hPa). Every level is read if empty.
+    std::vector<Real> levels;
+
+    /// Fixed grid spacings in x and y (m). The equirectangular projection is
+    /// used if zero.
+    Real spacing_x = 0.0;
+    Real spacing_y = 0.0;
+
+    /// Number of threads decoding time records.
+    unsigned int n_threads = 1;
+
+    /// Unique key of the data described.
+    std::string key() const;
+  };
+
+  /// Reads num_dims velocity components (u, v and, in 3D, w) of every time
+  /// record, or only the first one if time_dependant is false.
+  MetFileReader(const std::string & file_name,
+                const Options & options,
+                unsigned int num_dims,
+                bool time_dependant);
+
+  /// The x, y, z and t axes (index 0 to 3). z holds a single zero in 2D, and
+  /// t is in seconds from the first record.
+  const std::vector<Real> & axis(unsigned int i) const { return _axes[i]; }
+
+  /// Velocity slabs, indexed by [component][time index].
+  std::vector<std::vector<std::vector<Real>>> & data() { return _data; }
+
+  /// Height (m) of an isobaric pressure level (hPa) from the barometric
+  /// formula of the U.S. standard atmosphere.
+  static Real barometricHeight(Real pressure);
+
+  /// Converts a pressure velocity (Pa/s) to a vertical velocity (m/s).
+  static Real omegaToW(Real omega);
+
+protected:
+  const std::string _file_name;
+
+  /// The x, y, z and t axes.
+  std::vector<Real> _axes[4];
+
+  /// Velocity slabs, indexed by [component][time index].
+  std::vector<std::vector<std::vector<Real>>> _data;
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+#include "libmesh/vector_value.h"
+
+/**
+ * Quadrilinear (x-y-z-t) interpolation of a gridded velocity field. The field
+ * is stored as a series of time slabs (one per entry of the time axis) for
+ * each velocity component. Slabs either use the TrilinearInterpolation data
+ * layout (XYZ, the z index varies the fastest), or the layout of the binary
+ * wind field files (ZYX, the x index varies the fastest).
+ *
+ * The time bracket is located once through updateTime() (binary search), after
+ * which sample() blends the two bracketing slabs. Axis lookups use a constant
+ * time index computation for uniformly spaced axes and a binary search
+ * otherwise. Samples outside of the data axes are clamped to the boundary
+ * values, consistent with TrilinearInterpolation.
+ *
+ * The axes and slabs are not owned by this object.
+ */
+class SpaceTimeInterpolation
+{
+public:
+  /// Memory layout of a slab, listed from the slowest to the fastest index.
+  enum class Layout
+  {
+    XYZ,
+    ZYX
+  };
+
+  SpaceTimeInterpolation(const std::vector<Real> & x,
+                         const std::vector<Real> & y,
+                         const std::vector<Real> & z,
+                         const std::vector<Real> & t,
+                         unsigned int n_components,
+                         Layout layout = Layout::XYZ);
+
+  /// Sets the data slab of a velocity component at a given time index.
+  void setSlab(unsigned int component, unsigned int t_index, const Real * data);
+
+  /// Toggles linear blending between time slabs. If disabled, the slab at the
+  /// lower end of the time bracket is used (stepwise in time).
+  void setTimeInterpolation(bool linear) { _linear_in_time = linear; }
+
+  /// Locates the time bracket for time t. Returns true if the bracketing time
+  /// indices changed.
+  bool updateTime(Real t);
+
+  /// Computes the time bracket (indices and weight of the upper slab) for
+  /// time t without changing the current one.
+  void bracket(Real t, unsigned int & lower, unsigned int & upper, Real & weight) const;
+
+  /// Samples the velocity at point p for the current time bracket.
+  RealVectorValue sample(const Point & p) const;
+
+  /// Samples the velocity at a batch of points (e.g. all quadrature points of
+  /// an element) for the current time bracket. Uses scratch storage owned by
+  /// this object, and is therefore not safe to call concurrently.
+  void sample(const Point * points, unsigned int n_points, RealVectorValue * values) const;
+
+  /// Divergence of the interpolated velocity at point p for the current time
+  /// bracket. The interpolant is constant along an axis outside of its range.
+  Real divergence(const Point & p) const;
+
+  /// Accessors for the current time bracket.
+  unsigned int lowerTimeIndex() const { return _t_lower; }
+  unsigned int upperTimeIndex() const { return _t_upper; }
+  Real timeWeight() const { return _t_weight; }
+
+  /// Number of entries in each slab.
+  std::size_t slabSize() const { return _slab_size; }
+
+protected:
+  /// Precomputed lookup data for a single axis.
+  struct Axis
+  {
+    const std::vector<Real> * values;
+    bool uniform;
+    Real inv_spacing;
+  };
+
+  /// Initializes the lookup data for an axis.
+  static Axis buildAxis(const std::vector<Real> & values);
+
+  /// Computes the lower index and the weight of the upper index for x.
+  static void locate(const Axis & axis, Real x, unsigned int & lower, Real & weight);
+
+  /// Computes the slab offsets and weights of the 8 data points surrounding p.
+  void lookup(const Point & p, std::size_t * offsets, Real * weights) const;
+
+  /// Spatial and temporal axes.
+  Axis _x_axis;
+  Axis _y_axis;
+  Axis _z_axis;
+  const std::vector<Real> & _t_axis;
+
+  /// Number of velocity components stored (2 or 3).
+  const unsigned int _n_components;
+
+  /// Strides for the x, y and z indices in a slab.
+  const std::size_t _x_stride;
+  const std::size_t _y_stride;
+  const std::size_t _z_stride;
+  const std::size_t _slab_size;
+
+  /// Slab pointers, indexed by [component][time index].
+  std::vector<std::vector<const Real *>> _slabs;
+
+  /// Whether the time slabs are blended linearly.
+  bool _linear_in_time;
+
+  /// Current time bracket and the weight of the upper slab.
+  unsigned int _t_lower;
+  unsigned int _t_upper;
+  Real _t_weight;
+
+  /// Scratch storage for batched sampling.
+  mutable std::vector<std::size_t> _batch_offsets;
+  mutable std::vector<Real> _batch_weights;
+};
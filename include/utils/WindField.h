@@ -0,0 +1,152 @@
+#pragma once
+
+#include "SpaceTimeInterpolation.h"
+#include "WindFieldFile.h"
+#include "MetFileReader.h"
+
+#include <mutex>
+
+/**
+ * Per-process store of the velocity data (data axes and time slabs) read from
+ * a set of csv files, a binary wind field file or a NetCDF meteorological
+ * file. Stores are shared through
+ * acquire(), keyed by the file set and the way it is read, such that every
+ * material (and every thread) pointing to the same files uses a single copy
+ * of the meteorology. A store is released once its last user is destroyed.
+ *
+ * Users own a SpaceTimeInterpolation referencing the shared axes, and attach
+ * the slabs of their current time bracket to it. Attached time slabs are
+ * protected from eviction when the binary file is streamed. Only the first
+ * user to reach a new time bracket reads data, all later users reuse it.
+ *
+ * Data read from csv or meteorological files can be kept in a binary
+ * snapshot (a wind field file), which is mapped in place of the source files
+ * on later runs (e.g. when restarting from a checkpoint) as long as the
+ * source files are unchanged. Every store carries a fingerprint of its
+ * source files, such that users restored from a checkpoint can detect a new
+ * data set (e.g. an updated forecast).
+ */
+class WindField
+{
+public:
+  /// Description of the velocity data to read.
+  struct Spec
+  {
+    /// csv files for the u, v, (w) components and the data axes, in that
+    /// order. Unused if wind_file or met_file is set.
+    std::vector<std::string> file_names;
+    std::string delimiter = ",";
+
+    /// Binary wind field file.
+    std::string wind_file;
+
+    /// Number of mesh dimensions (2 or 3).
+    unsigned int num_dims = 3;
+
+    /// Whether every data time is read or only the first.
+    bool time_dependant = false;
+
+    /// Streaming options for the binary wind field file.
+    bool streaming = false;
+    unsigned int prefetch_depth = 1;
+
+    /// NetCDF meteorological file, and the data extracted from it.
+    std::string met_file;
+    MetFileReader::Options met_options;
+
+    /// Binary snapshot of the data read from csv or meteorological files.
+    std::string snapshot;
+
+    /// Unique key of the data described.
+    std::string key() const;
+
+    /// Hash of the key of the source data (excluding the snapshot) and of the
+    /// size and modification time of the source files.
+    std::uint64_t fingerprint() const;
+  };
+
+  /// Returns the store for a data set, reading it if no other user holds it.
+  static std::shared_ptr<WindField> acquire(const Spec & spec);
+
+  WindField(const Spec & spec);
+
+  WindField(const WindField &) = delete;
+  WindField & operator=(const WindField &) = delete;
+
+  /// The x, y, z and t data axes (index 0 to 3).
+  const std::vector<Real> & axis(unsigned int i) const { return _dimensions[i]; }
+
+  /// Number of velocity components sampled (the number of mesh dimensions).
+  unsigned int numComponents() const { return _n_components; }
+
+  /// Fingerprint of the source data (see Spec::fingerprint()).
+  std::uint64_t fingerprint() const { return _fingerprint; }
+
+  /// Builds an interpolator over the data axes of this store.
+  std::unique_ptr<SpaceTimeInterpolation> buildInterpolator() const;
+
+  /// Hands the slabs of a time bracket to an interpolator and protects them
+  /// from eviction until the bracket is detached.
+  void attach(SpaceTimeInterpolation & interp, unsigned int lower, unsigned int upper);
+
+  /// Releases a time bracket previously attached.
+  void detach(unsigned int lower, unsigned int upper);
+
+  /// Writes the velocity data read from csv or meteorological files to the
+  /// snapshot of the spec, unless it was mapped from the snapshot or already
+  /// written. Should only be called by one process.
+  void writeSnapshot();
+
+  /// Number of bytes of velocity data held in process memory.
+  std::size_t residentBytes() const;
+
+  /// Number of bytes of velocity data held in process memory by every store.
+  static std::size_t totalResidentBytes();
+
+protected:
+  /// Reads the velocity components and data axes from csv files.
+  void csvConstruct(const Spec & spec);
+
+  /// Maps or streams a binary wind field file.
+  void fileConstruct(const Spec & spec);
+
+  /// Reads the velocity components from a NetCDF meteorological file.
+  void metConstruct(const Spec & spec);
+
+  /// Maps the snapshot of the source data. Returns false if there is no
+  /// snapshot, or if it was taken from other source files.
+  bool snapshotConstruct(const Spec & spec);
+
+  /// Removes irrelevent datapoints from the axes read from the csv files.
+  static void cleanAxisData(std::vector<Real> & array_to_clean);
+
+  /// Vectors of values for the data axes (x, y, z, t).
+  std::vector<std::vector<Real>> _dimensions;
+
+  /// Velocity data held in memory (read from csv or meteorological files),
+  /// indexed by [component][time index].
+  std::vector<std::vector<std::vector<Real>>> _slab_data;
+
+  /// Memory layout of the velocity slabs.
+  SpaceTimeInterpolation::Layout _layout;
+
+  /// Binary wind field file, if one was provided.
+  std::unique_ptr<WindFieldFile> _wind_file;
+
+  /// Number of velocity components sampled.
+  unsigned int _n_components;
+
+  /// Fingerprint of the source data.
+  const std::uint64_t _fingerprint;
+
+  /// Snapshot still to be written, empty once written or if none is kept.
+  std::string _pending_snapshot;
+
+  /// Guards the binary wind field file, which is shared between threads, and
+  /// the pending snapshot.
+  mutable std::mutex _mutex;
+
+  /// Registry of the stores in use in this process.
+  static std::map<std::string, std::weak_ptr<WindField>> _registry;
+  static std::mutex _registry_mutex;
+};
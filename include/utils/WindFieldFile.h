@@ -0,0 +1,171 @@
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+
+/**
+ * Read-only access to a binary CARIBOU wind field file. The file is memory
+ * mapped, such that processes on the same node share the page cache and only
+ * the time slabs which are sampled are ever read from disk.
+ *
+ * In streaming mode the file is not mapped. Only the time records (all
+ * velocity components at a data time) bracketing the current time are held
+ * in memory, records following the bracket are read on background threads
+ * up to a prefetch depth and records preceding the bracket are evicted.
+ *
+ * File layout (little endian):
+ *   - A 64 byte header (see Header), holding the number of velocity
+ *     components, the size of a stored value (8 for float64, 4 for float32),
+ *     the axis lengths, the byte offset of the velocity data and the
+ *     fingerprint of the data the file was converted from (zero if unknown).
+ *   - The x, y, z and t axes, stored as float64 in that order.
+ *   - The velocity data, starting at a page aligned offset and stored as
+ *     [t][component][z][y][x] (the x index varies the fastest).
+ *
+ * Files are produced by python/wind_binary_utils.py, either through the csv
+ * converter or the binary export of python/Weather_format.py, or written by
+ * CARIBOU as snapshots of the wind data read from csv or meteorological files
+ * (see WindField).
+ */
+class WindFieldFile
+{
+public:
+  WindFieldFile(const std::string & file_name,
+                bool streaming = false,
+                unsigned int prefetch_depth = 1);
+  ~WindFieldFile();
+
+  WindFieldFile(const WindFieldFile &) = delete;
+  WindFieldFile & operator=(const WindFieldFile &) = delete;
+
+  /// The x, y, z and t axes (index 0 to 3).
+  const std::vector<Real> & axis(unsigned int i) const { return _axes[i]; }
+
+  /// Number of velocity components stored in the file.
+  unsigned int numComponents() const { return _header.n_components; }
+
+  /// Number of values in a single slab.
+  std::size_t slabSize() const { return _slab_size; }
+
+  /// Returns the slab of a velocity component at a time index. float64 data
+  /// is returned in place from the mapping, float32 data is widened on first
+  /// access. When streaming, the time record is read if it is not resident.
+  const Real * slab(unsigned int component, unsigned int t_index);
+
+  /// Informs the file of the current time bracket. When streaming, evicts the
+  /// records preceding the bracket which are not in use and prefetches the
+  /// records following it. When mapped, frees the widened float32 slabs
+  /// preceding the bracket which are not in use. Slabs previously returned
+  /// for evicted records are invalidated.
+  void advance(unsigned int t_lower, unsigned int t_upper);
+
+  /// Marks a time record as in use (or no longer in use), which protects it
+  /// from eviction.
+  void acquire(unsigned int t_index);
+  void release(unsigned int t_index);
+
+  /// Whether the file is streamed rather than mapped.
+  bool streaming() const { return _streaming; }
+
+  /// Number of bytes of velocity data held in process memory (excluding the
+  /// shared page cache of a mapped file).
+  std::size_t residentBytes() const;
+
+  /// Name of the file this object maps.
+  const std::string & fileName() const { return _file_name; }
+
+  /// Fingerprint of the data the file was converted from (zero if unknown).
+  std::uint64_t sourceFingerprint() const { return _header.source_fingerprint; }
+
+  /// Fills a slab (component, time index, slab storage) in the file layout.
+  typedef std::function<void(unsigned int, unsigned int, std::vector<Real> &)> SlabWriter;
+
+  /// Writes a float64 wind field file from its x, y, z and t axes and a
+  /// function filling its slabs. The file is written under a unique
+  /// temporary name (mkstemp) and renamed once complete, such that concurrent
+  /// writers (e.g. separate runs sharing the file system) never collide and
+  /// readers never see a partial file.
+  static void write(const std::string & file_name,
+                    const std::vector<std::vector<Real>> & axes,
+                    unsigned int n_components,
+                    std::uint64_t source_fingerprint,
+                    const SlabWriter & slab_writer);
+
+  /// Binary header of the file.
+  struct Header
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t n_components;
+    std::uint32_t value_size;
+    std::uint32_t nx;
+    std::uint32_t ny;
+    std::uint32_t nz;
+    std::uint32_t nt;
+    std::uint64_t data_offset;
+    std::uint64_t source_fingerprint;
+    std::uint64_t reserved;
+  };
+
+  /// Expected values of the header identification fields.
+  static const char FILE_MAGIC[8];
+  static const std::uint32_t FILE_VERSION;
+  static const std::uint32_t ENDIAN_MARKER;
+
+protected:
+  /// Byte offset of the slab of a component at a time index.
+  std::size_t slabOffset(unsigned int component, unsigned int t_index) const;
+
+  /// Copies bytes from the file, either from the mapping or through pread.
+  void readBytes(std::size_t offset, std::size_t size, void * destination) const;
+
+  /// Reads all velocity components at a time index. Safe to call from a
+  /// background thread.
+  std::vector<Real> readRecord(unsigned int t_index) const;
+
+  /// Returns the resident time record, reading it if required.
+  const std::vector<Real> & residentRecord(unsigned int t_index);
+
+  /// Name of the file.
+  const std::string _file_name;
+
+  /// Whether the file is streamed, and the number of records read ahead.
+  const bool _streaming;
+  const unsigned int _prefetch_depth;
+
+  /// Header read from the file.
+  Header _header;
+
+  /// The x, y, z and t axes.
+  std::vector<Real> _axes[4];
+
+  /// Number of values in a slab.
+  std::size_t _slab_size;
+
+  /// File descriptor (streaming only), file size in bytes and mapped file.
+  int _fd;
+  std::size_t _file_size;
+  void * _map;
+
+  /// Widened float32 slabs of a mapped file, indexed by
+  /// [t_index * n_components + component].
+  std::vector<std::vector<Real>> _widened;
+
+  /// Resident time records and pending background reads when streaming.
+  std::map<unsigned int, std::vector<Real>> _resident;
+  std::map<unsigned int, std::future<std::vector<Real>>> _pending;
+
+  /// Background reads of records evicted before they completed. Destroying
+  /// the future of an std::async call waits for it, so they are kept until
+  /// they are ready rather than blocking the solve.
+  std::list<std::future<std::vector<Real>>> _abandoned;
+
+  /// Number of users of each time record in use.
+  std::map<unsigned int, unsigned int> _users;
+};
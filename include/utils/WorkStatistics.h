@@ -0,0 +1,110 @@
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/communicator.h"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// Work done by an instrumented code path: number of calls, number of items
+/// processed (e.g. velocity samples) and wall time.
+struct WorkCounter
+{
+  std::uint64_t calls = 0;
+  std::uint64_t items = 0;
+  Real time = 0.0;
+};
+
+/**
+ * Per-process registry of the counters of the CARIBOU hot paths (wind field
+ * ingestion and time bracket updates, velocity samples, residual and Jacobian
+ * evaluations of the transport kernels, point source location).
+ *
+ * Every instrumented object (one per thread) owns the counters it updates,
+ * such that the hot paths are not synchronized, registers them under the
+ * name of its application and a counter name, and removes them when it is
+ * destroyed (an application rebuilt under the same name starts from zero). The applications of a MultiApp
+ * run in the same process keep separate counters, even if their objects share
+ * names. Counters sharing a name within an application are summed when read,
+ * which should not happen concurrently with their updates (e.g. from a
+ * postprocessor or user object).
+ *
+ * Calls and items are always counted. Timing reads the steady clock at both
+ * ends of a timed scope, and is only enabled when a report is requested (see
+ * PerformanceReport). Timed scopes are never narrower than an element.
+ */
+class WorkStatistics
+{
+public:
+  /// Registers a new counter of an application under a name.
+  static WorkCounter & add(const std::string & app, const std::string & name);
+
+  /// Removes a counter registered by add(), which must not be used afterwards.
+  static void remove(const std::string & app, const WorkCounter & counter);
+
+  /// Sum of the counters of an application registered under a name.
+  static WorkCounter total(const std::string & app, const std::string & name);
+
+  /// Sums of the counters of an application, by name.
+  static std::map<std::string, WorkCounter> totals(const std::string & app);
+
+  /// Reduces counters over the processes of a communicator, by name: calls
+  /// and items are summed and the time is the maximum over processes. Every
+  /// process ends with the union of the names, whatever the counters it
+  /// registered.
+  static void reduce(const Parallel::Communicator & comm,
+                     std::map<std::string, WorkCounter> & counters);
+
+  /// Toggles the timing of the instrumented scopes.
+  static void setTiming(bool timing) { _timing = timing; }
+  static bool timing() { return _timing; }
+
+protected:
+  /// Counters registered in this process, by application and name. Counters
+  /// are allocated separately, such that their addresses remain valid until
+  /// they are removed.
+  static std::map<std::string, std::map<std::string, std::vector<std::unique_ptr<WorkCounter>>>>
+      _registry;
+  static std::mutex _registry_mutex;
+
+  static bool _timing;
+};
+
+/**
+ * Counts a call and, if timing is enabled, adds the wall time of the
+ * enclosing scope to a counter. One-off work (e.g. reading the wind data)
+ * may be timed regardless.
+ */
+class ScopedWork
+{
+public:
+  ScopedWork(WorkCounter & counter,
+             std::uint64_t items = 0,
+             bool timed = WorkStatistics::timing())
+    : _counter(counter), _timed(timed)
+  {
+    _counter.calls++;
+    _counter.items += items;
+    if (_timed)
+      _start = std::chrono::steady_clock::now();
+  }
+
+  ~ScopedWork()
+  {
+    if (_timed)
+      _counter.time +=
+          std::chrono::duration<Real>(std::chrono::steady_clock::now() - _start).count();
+  }
+
+  ScopedWork(const ScopedWork &) = delete;
+  ScopedWork & operator=(const ScopedWork &) = delete;
+
+protected:
+  WorkCounter & _counter;
+  const bool _timed;
+  std::chrono::steady_clock::time_point _start;
+};
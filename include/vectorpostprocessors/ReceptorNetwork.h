@@ -0,0 +1,86 @@
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+
+#include <fstream>
+
+// Forward declarations.
+class MooseVariableFEBase;
+
+/**
+ * Samples a variable at a network of receptors (monitoring stations,
+ * population centroids) read from a csv file, and accumulates the time
+ * integrated concentration and the peak concentration of each receptor.
+ *
+ * The element containing each receptor, its degrees of freedom and the shape
+ * function values at the receptor are computed once and reused until the mesh
+ * changes, such that sampling costs a dot product per receptor. Each process
+ * samples the receptors inside its own elements. The accumulated values are
+ * restartable.
+ *
+ * The concentrations can be appended to a compact csv file every time the
+ * network is executed (one row per time), which allows the field output to
+ * be disabled or made sparse.
+ */
+class ReceptorNetwork : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  ReceptorNetwork(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Locates the receptors inside the elements owned by this process.
+  void locateReceptors();
+
+  /// Appends the current concentrations to the output file.
+  void writeRow();
+
+  /// Receptor inside an element owned by this process.
+  struct LocalReceptor
+  {
+    std::size_t index;
+    std::vector<dof_id_type> dofs;
+    std::vector<Real> shape;
+  };
+
+  /// Variable sampled.
+  MooseVariableFEBase & _var;
+
+  /// Receptor locations.
+  std::vector<Point> _receptors;
+
+  /// Receptors owned by this process, located for the current mesh.
+  std::vector<LocalReceptor> _local_receptors;
+  bool _located;
+
+  /// Sampled and accumulated values of every receptor.
+  VectorPostprocessorValue & _x;
+  VectorPostprocessorValue & _y;
+  VectorPostprocessorValue & _z;
+  VectorPostprocessorValue & _value;
+  VectorPostprocessorValue & _integral;
+  VectorPostprocessorValue & _peak;
+  VectorPostprocessorValue & _peak_time;
+
+  /// Accumulated values, kept as restartable data.
+  std::vector<Real> & _integral_state;
+  std::vector<Real> & _peak_state;
+  std::vector<Real> & _peak_time_state;
+
+  /// Values and time of the previous sample, for the time integral.
+  std::vector<Real> & _previous_value;
+  Real & _previous_time;
+  bool & _sampled;
+
+  /// Compact csv output of the concentrations.
+  const bool _write_file;
+  std::ofstream _file;
+};
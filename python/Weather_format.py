@@ -12,10 +12,12 @@ import numpy as np
 import pandas as pd
 import os
 import barometric_utils as bu
+import wind_binary_utils as wbu
 import csv
 
 def convert_by_latlong(file, point1, point2, p_level,
-                       times, deltas=[31000.0, 31000.0]):
+                       times, deltas=[31000.0, 31000.0], output_format='csv',
+                       binary_dtype='float64'):
     """
     This function extracts long-lat data within a bounded region defined by
     the input parameters. It than converts the long/lat coordinates to an
@@ -37,6 +39,10 @@ def convert_by_latlong(file, point1, point2, p_level,
         lat/long values to x (entry 0) and y (entry 1) values. By default,
         this is 31 km between datapoints in both lat and long (default for
         ERA5 reanalysis).
+        output_format: 'csv' (default) or 'binary'. The binary format is
+        read directly by STMaterial through the wind_file_name parameter.
+        binary_dtype: 'float64' (default) or 'float32', the precision of the
+        velocity data in the binary format.
     Outputs:
         u.csv (csv file containing the magnitude of the east-facing wind
         component, m/s).
@@ -62,6 +68,10 @@ def convert_by_latlong(file, point1, point2, p_level,
         values. CARIBOU's file reading scheme can decode the data and remove
         these superfluous zeroes (using the GenericCaribousMaterial or the
         STMaterial materials).
+
+        If output_format is 'binary', a single file (wind.cwf) is written in
+        place of the csv files. It holds the axes and the velocity data of
+        every timestep (see wind_binary_utils.py for the layout).
     """
 
     #Declaring output directory
@@ -263,6 +273,18 @@ def convert_by_latlong(file, point1, point2, p_level,
     #Close GRIB file
     grbs.close()
 
+    if output_format == 'binary':
+        print('Writing to the binary wind field file.')
+
+        #Each dataframe column holds a timestep in the csv ordering.
+        wbu.write_wind_binary(os.path.join(output_dir, 'wind.cwf'), grid_x,
+                              grid_y, grid_z, grid_t[:len(df_u.columns)],
+                              [df_u.values.T, df_v.values.T, df_w.values.T],
+                              binary_dtype)
+
+        print('Coordinate transform complete. Binary file has been written.')
+        return
+
     #Generating file names.
     u_out_file = os.path.join(output_dir, 'u.csv')
     v_out_file = os.path.join(output_dir, 'v.csv')
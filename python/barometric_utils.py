@@ -20,8 +20,8 @@ def barometric_height(pressure):
     """
     #Define level dependant constants.
     p_b = [1013.25, 226.321, 54.7489, 8.6802, 1.1091, 0.6694, 0.0396]
-    h_b = [11000, 20000, 32000, 47000, 51000, 71000]
-    t_b = [288.15, 216.65, 216.15, 228.65, 270.65, 270.65, 214.65]
+    h_b = [0, 11000, 20000, 32000, 47000, 51000, 71000]
+    t_b = [288.15, 216.65, 216.65, 228.65, 270.65, 270.65, 214.65]
     l_b = [-0.0065, 0.0, 0.001, 0.0028, 0.0, -0.0028, -0.002]
 
     #Define constants.
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+This is a utility script which writes the source tables read by CARIBOU's
+MultiPointSource, either as a pair of csv files (points_file and rates_file)
+or as a binary source file (source_file). It can also be executed directly to
+convert a pair of csv files to the binary format.
+
+Binary file layout (little endian):
+    32 byte header: magic (8 bytes, 'CRBSRCE\\0'), version (uint32), byte
+    order marker (uint32, 0x01020304), number of sources (uint32), number of
+    release times (uint32) and 8 reserved bytes.
+    Source locations (float64, x, y, z for each source).
+    Release times (float64).
+    Release rates (float64), stored as [time][source].
+"""
+import argparse
+import struct
+import numpy as np
+import pandas as pd
+
+MAGIC = b'CRBSRCE\x00'
+VERSION = 1
+BYTE_ORDER = 0x01020304
+HEADER_FORMAT = '<8sIIII8x'
+
+def write_source_csv(points_file, rates_file, points, times, rates):
+    """
+    This function writes a source table as csv files.
+
+    Input parameters:
+        points_file, rates_file: strings of the filenames.
+        points: array of shape (n_sources, 2 or 3) of the source locations.
+        times: 1-D array of the times at which the release rates change.
+        rates: array of shape (n_times, n_sources) of the release rates, each
+        applying from its time until the next one.
+    """
+    points = np.asarray(points, dtype=float)
+    rates = np.asarray(rates, dtype=float).reshape(len(times), len(points))
+
+    pd.DataFrame(points, columns=['x', 'y', 'z'][:points.shape[1]]) \
+      .to_csv(points_file, index=False)
+
+    columns = {'time': np.asarray(times, dtype=float)}
+    for p in range(len(points)):
+        columns['source_' + str(p)] = rates[:, p]
+    pd.DataFrame(columns).to_csv(rates_file, index=False)
+
+def write_source_binary(file, points, times, rates):
+    """
+    This function writes a binary source file. The input parameters are the
+    same as for write_source_csv.
+    """
+    points = np.asarray(points, dtype='<f8')
+    if points.shape[1] == 2:
+        points = np.hstack((points, np.zeros((len(points), 1))))
+    times = np.asarray(times, dtype='<f8')
+    rates = np.asarray(rates, dtype='<f8').reshape(len(times), len(points))
+
+    with open(file, 'wb') as out:
+        out.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, BYTE_ORDER,
+                              len(points), len(times)))
+        out.write(points.tobytes())
+        out.write(times.tobytes())
+        out.write(rates.tobytes())
+
+def convert_csv(points_file, rates_file, out_file):
+    """
+    This function converts a csv source table to a binary source file.
+    """
+    points = pd.read_csv(points_file).values
+    rates = pd.read_csv(rates_file).values
+    write_source_binary(out_file, points, rates[:, 0], rates[:, 1:])
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Convert a CARIBOU csv '
+                                     'source table to the binary format.')
+    parser.add_argument('points', help='csv file of the source locations')
+    parser.add_argument('rates', help='csv file of the release rates')
+    parser.add_argument('-o', '--output', default='sources.csrc',
+                        help='output file name')
+    args = parser.parse_args()
+
+    convert_csv(args.points, args.rates, args.output)
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+This is a utility script which combines unit release responses into the
+response to arbitrary source terms. Transport being linear, the concentration
+at a set of receptors for a release schedule is the sum of the responses to
+unit releases (UnitReleaseSource) from each source location and release
+interval, scaled by the amount released by the schedule in that interval.
+
+Radioactive decay (without ingrowth) is applied to the unit responses, which
+are computed without decay, using the age of the material since the middle of
+its release interval. The decay of a release is therefore exact for releases
+short with respect to the half-life.
+
+Input files (csv):
+    manifest: one row per unit release run, with the columns source (name of
+    the release location), start, end (release interval) and file (receptor
+    time series of the run: a time column followed by one column per
+    receptor, e.g. the csv output of MOOSE postprocessors). Every file must
+    share the same times and receptors.
+    schedule: one row per release, with the columns hypothesis, nuclide,
+    source, start, end and rate (amount released per unit time, uniformly
+    over [start, end)).
+    nuclides: one row per nuclide, with the columns nuclide and
+    decay_constant.
+Output file (csv):
+    columns hypothesis, nuclide, time, followed by one column per receptor.
+"""
+import argparse
+import numpy as np
+import pandas as pd
+
+def read_unit_responses(manifest):
+    """
+    This function reads the unit release responses listed in a manifest.
+
+    Input parameters:
+        manifest: pandas DataFrame with the columns source, start, end and
+        file.
+    Returns:
+        times (1-D array), receptor names (python list) and the responses,
+        an array of shape (n_units, n_times, n_receptors).
+    """
+    times = None
+    receptors = None
+    responses = []
+    for name in manifest['file']:
+        data = pd.read_csv(name)
+        run_times = data.iloc[:, 0].values
+        if times is None:
+            times = run_times
+            receptors = list(data.columns[1:])
+        elif len(run_times) != len(times) or not np.allclose(run_times, times) \
+             or list(data.columns[1:]) != receptors:
+            raise ValueError(name + ' does not share the times and receptors '
+                             'of the other unit release responses')
+        responses.append(data.iloc[:, 1:].values)
+    return times, receptors, np.array(responses)
+
+def release_amounts(manifest, schedule):
+    """
+    This function computes the amount released in each unit release interval
+    by every (hypothesis, nuclide) pair of a schedule.
+
+    Input parameters:
+        manifest: pandas DataFrame of the unit releases.
+        schedule: pandas DataFrame with the columns hypothesis, nuclide,
+        source, start, end and rate.
+    Returns:
+        python list of the (hypothesis, nuclide) pairs and an array of shape
+        (n_pairs, n_units) of the amounts, which scale the unit responses.
+    """
+    pairs = list(dict.fromkeys(zip(schedule['hypothesis'], schedule['nuclide'])))
+    index = {pair: i for i, pair in enumerate(pairs)}
+    amounts = np.zeros((len(pairs), len(manifest)))
+
+    unit_start = manifest['start'].values
+    unit_end = manifest['end'].values
+    unit_source = manifest['source'].astype(str).values
+
+    for row in schedule.itertuples(index=False):
+        overlap = np.minimum(unit_end, row.end) - np.maximum(unit_start, row.start)
+        overlap = np.where(unit_source == str(row.source),
+                           np.maximum(overlap, 0.0), 0.0)
+        amounts[index[(row.hypothesis, row.nuclide)]] += row.rate*overlap
+
+        released = overlap.sum()
+        if not np.isclose(released, row.end - row.start):
+            raise ValueError('The release of ' + str(row.hypothesis) + ' from '
+                             + str(row.source) + ' over [' + str(row.start)
+                             + ', ' + str(row.end) + ') is not covered by the '
+                             'unit releases')
+
+    return pairs, amounts
+
+def superpose(manifest, schedule, decay_constants):
+    """
+    This function combines the unit release responses for every (hypothesis,
+    nuclide) pair of a schedule.
+
+    Input parameters:
+        manifest, schedule: pandas DataFrames (see release_amounts).
+        decay_constants: python dictionary of the decay constant of each
+        nuclide.
+    Returns:
+        pandas DataFrame in the output format.
+    """
+    times, receptors, responses = read_unit_responses(manifest)
+    pairs, amounts = release_amounts(manifest, schedule)
+
+    # Age of the material released in each interval at each time.
+    middle = 0.5*(manifest['start'].values + manifest['end'].values)
+    age = np.maximum(times[None, :] - middle[:, None], 0.0)
+
+    frames = []
+    for (hypothesis, nuclide), amount in zip(pairs, amounts):
+        decay = np.exp(-decay_constants[nuclide]*age)
+        values = np.einsum('u,ut,utr->tr', amount, decay, responses)
+        frame = pd.DataFrame(values, columns=receptors)
+        frame.insert(0, 'time', times)
+        frame.insert(0, 'nuclide', nuclide)
+        frame.insert(0, 'hypothesis', hypothesis)
+        frames.append(frame)
+
+    return pd.concat(frames, ignore_index=True)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Combine CARIBOU unit release '
+                                     'responses into the responses to a set '
+                                     'of source term hypotheses.')
+    parser.add_argument('manifest', help='csv file of the unit release runs')
+    parser.add_argument('schedule', help='csv file of the release schedules')
+    parser.add_argument('nuclides', help='csv file of the decay constants')
+    parser.add_argument('-o', '--output', default='superposition.csv',
+                        help='output file name')
+    args = parser.parse_args()
+
+    nuclides = pd.read_csv(args.nuclides)
+    decay_constants = dict(zip(nuclides['nuclide'], nuclides['decay_constant']))
+
+    superpose(pd.read_csv(args.manifest), pd.read_csv(args.schedule),
+              decay_constants).to_csv(args.output, index=False)
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+This is a utility script which reads and writes the binary wind field format
+accepted by CARIBOU's STMaterial (wind_file_name parameter). It can also be
+executed directly to convert the csv files produced by Weather_format.py to
+the binary format.
+
+File layout (little endian):
+    64 byte header: magic (8 bytes, 'CRBWIND\\0'), version (uint32), byte order
+    marker (uint32, 0x01020304), number of velocity components (uint32),
+    bytes per value (uint32, 8 for float64 or 4 for float32), nx, ny, nz, nt
+    (uint32), byte offset of the velocity data (uint64), fingerprint of the
+    data the file was converted from (uint64, zero if unknown, set by the
+    snapshots written by CARIBOU) and 8 reserved bytes.
+    x, y, z and t axes (float64, in that order).
+    Velocity data, starting at a page aligned offset and stored as
+    [t][component][z][y][x] (x varies the fastest).
+"""
+import argparse
+import struct
+import numpy as np
+import pandas as pd
+
+MAGIC = b'CRBWIND\x00'
+VERSION = 1
+BYTE_ORDER = 0x01020304
+HEADER_FORMAT = '<8sIIIIIIIIQ16x'
+PAGE_SIZE = 4096
+
+def write_wind_binary(file, x, y, z, t, components, dtype='float64'):
+    """
+    This function writes a binary wind field file.
+
+    Input parameters:
+        file: string of the filename.
+        x, y, z, t: 1-D arrays containing the data axes. Unused axes (z for a
+        2-D problem, t for a time independant velocity field) should contain
+        a single zero.
+        components: python list of the velocity components (u, v and
+        optionally w). Each component is an array of shape (nt, nx*ny*nz)
+        where each row follows the csv data ordering (the z index varies the
+        fastest, the x index the slowest).
+        dtype: 'float64' or 'float32', the precision of the stored velocity
+        data. The axes are always stored as float64.
+    """
+    x, y, z, t = (np.asarray(a, dtype='<f8') for a in (x, y, z, t))
+    nx, ny, nz, nt = len(x), len(y), len(z), len(t)
+
+    if dtype not in ('float64', 'float32'):
+        raise ValueError('dtype must be float64 or float32')
+    if len(components) not in (2, 3):
+        raise ValueError('2 or 3 velocity components are required')
+
+    value_type = '<f8' if dtype == 'float64' else '<f4'
+    axis_bytes = 8*(nx + ny + nz + nt)
+    data_offset = ((64 + axis_bytes + PAGE_SIZE - 1)//PAGE_SIZE)*PAGE_SIZE
+
+    #Reorder every component from [t][x][y][z] to [t][z][y][x].
+    data = np.empty((nt, len(components), nz, ny, nx), dtype=value_type)
+    for c, component in enumerate(components):
+        component = np.asarray(component).reshape(nt, nx, ny, nz)
+        data[:, c] = component.transpose(0, 3, 2, 1)
+
+    with open(file, 'wb') as out:
+        out.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, BYTE_ORDER,
+                              len(components), np.dtype(value_type).itemsize,
+                              nx, ny, nz, nt, data_offset))
+        for axis in (x, y, z, t):
+            out.write(axis.tobytes())
+        out.write(b'\x00'*(data_offset - 64 - axis_bytes))
+        out.write(data.tobytes())
+
+def read_wind_binary(file):
+    """
+    This function reads a binary wind field file.
+
+    Input parameters:
+        file: string of the filename.
+    Returns:
+        python list containing the x, y, z and t axes and a numpy array of
+        the velocity data with shape (nt, n_components, nz, ny, nx). The data
+        is memory mapped.
+    """
+    with open(file, 'rb') as inp:
+        header = struct.unpack(HEADER_FORMAT, inp.read(64))
+    magic, version, byte_order, n_comp, value_size, nx, ny, nz, nt, offset = header
+
+    if magic != MAGIC or byte_order != BYTE_ORDER or version != VERSION:
+        raise ValueError(file + ' is not a supported CARIBOU wind field file')
+
+    axes = []
+    position = 64
+    for n in (nx, ny, nz, nt):
+        axes.append(np.fromfile(file, dtype='<f8', count=n, offset=position))
+        position += 8*n
+
+    value_type = '<f8' if value_size == 8 else '<f4'
+    data = np.memmap(file, dtype=value_type, mode='r', offset=offset,
+                     shape=(nt, n_comp, nz, ny, nx))
+
+    return axes + [data]
+
+def clean_axis_data(axis):
+    """
+    Removes the zero padding added to the columns of coords.csv, following the
+    same rules as STMaterial::cleanAxisData.
+    """
+    axis = list(axis)
+    if len(axis) > 1:
+        for i in range(1, len(axis)):
+            if axis[i] == 0.0 and axis[i - 1] != 0.0:
+                axis = axis[:i]
+                break
+        if len(axis) > 1 and axis[0] == 0.0 and axis[1] == 0.0:
+            axis = axis[:1]
+    return np.array(axis)
+
+def convert_csv(coords_file, component_files, out_file, time_dependant=True,
+                dtype='float64'):
+    """
+    This function converts the csv files produced by Weather_format.py to a
+    binary wind field file.
+
+    Input parameters:
+        coords_file: string of the coordinate filename (coords.csv).
+        component_files: python list of the filenames for the u, v and
+        (optionally) w components.
+        out_file: string of the output filename.
+        time_dependant: if False, only the first time column is converted.
+        dtype: 'float64' or 'float32'.
+    """
+    coords = pd.read_csv(coords_file)
+    names = list(coords.columns)
+
+    x = clean_axis_data(coords[names[0]].values)
+    y = clean_axis_data(coords[names[1]].values)
+    if len(component_files) == 3:
+        z = clean_axis_data(coords[names[2]].values)
+        t_column = 3
+    else:
+        z = np.zeros(1)
+        t_column = 2
+
+    if time_dependant and len(names) > t_column:
+        t = clean_axis_data(coords[names[t_column]].values)
+    else:
+        t = np.zeros(1)
+
+    components = []
+    for name in component_files:
+        values = pd.read_csv(name).values
+        components.append(values[:, :len(t)].T)
+
+    write_wind_binary(out_file, x, y, z, t, components, dtype)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Convert CARIBOU csv wind '
+                                     'data to the binary wind field format.')
+    parser.add_argument('coords', help='coordinate file (coords.csv)')
+    parser.add_argument('components', nargs='+',
+                        help='u, v and (optionally) w files')
+    parser.add_argument('-o', '--output', default='wind.cwf',
+                        help='output file name')
+    parser.add_argument('--float32', action='store_true',
+                        help='store the velocity data in single precision')
+    parser.add_argument('--time-independant', action='store_true',
+                        help='only convert the first time column')
+    args = parser.parse_args()
+
+    if len(args.components) not in (2, 3):
+        parser.error('2 or 3 velocity component files are required')
+
+    convert_csv(args.coords, args.components, args.output,
+                not args.time_independant,
+                'float32' if args.float32 else 'float64')
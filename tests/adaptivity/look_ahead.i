@@ -0,0 +1,79 @@
+# Refinement ahead of a plume front. The concentration is held fixed (only a
+# time derivative acts on it) at 1 for x <= 500 m and 0 beyond, in a 100 m/s
+# wind along x. The front element [500, 600] and the elements behind it are
+# refined through the indicator (concentration and its jump). Looking 3 s
+# ahead, the elements within 300 m downwind of the front, [600, 900], have the
+# plume on their upstream paths and are refined as well, while [900, 1000]
+# and beyond are not: 20 + 9 = 29 elements after one refinement.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 20
+  xmin = 0.0
+  xmax = 2000.0
+[]
+
+[Variables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+
+    [./InitialCondition]
+      type = FunctionIC
+      function = 'if(x < 550.0, 1.0, 0.0)'
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = concentration
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    const_velocity = '100.0 0.0 0.0'
+  [../]
+[]
+
+[Adaptivity]
+  marker = plume
+  max_h_level = 1
+  [./Indicators]
+    [./plume]
+      type = PlumeIndicator
+      variable = concentration
+      look_ahead_time = 3.0
+    [../]
+  [../]
+  [./Markers]
+    [./plume]
+      type = PlumeMarker
+      indicator = plume
+      refine = 0.1
+      coarsen = 0.01
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./active_elements]
+    type = NumElems
+    elem_filter = active
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'final'
+  csv = true
+[]
@@ -0,0 +1,104 @@
+# Plume following adaptivity around a point source in a uniform wind.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0.0
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = concentration
+  [../]
+
+  [./advc]
+    type = STAdvection
+    variable = concentration
+    upwinding_type = supg
+  [../]
+
+  [./time]
+    type = STTimeDerivative
+    variable = concentration
+  [../]
+[]
+
+[DiracKernels]
+  [./srce]
+    variable = concentration
+    type = TimedPointSource
+    rate = 1.0
+    point = '1200.0 775.0 0.0'
+    deactivation_time = 5.0
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = ConstantOutflowBC
+    variable = concentration
+    boundary = '3'
+    velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    const_velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Adaptivity]
+  marker = plume
+  max_h_level = 3
+  [./Indicators]
+    [./plume]
+      type = PlumeIndicator
+      variable = concentration
+      look_ahead_time = 1.0
+    [../]
+  [../]
+  [./Markers]
+    [./plume]
+      type = PlumeMarker
+      indicator = plume
+      refine = 1e-3
+      coarsen = 1e-5
+      source_points = '1200.0 775.0 0.0'
+      source_radius = 50.0
+      source_end_time = 5.0
+    [../]
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  exodus = true
+[]
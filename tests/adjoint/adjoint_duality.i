@@ -0,0 +1,87 @@
+# Adjoint half of the duality check of test_duality.py. The receptor of
+# forward_duality.i measures at the forward time step 10, the adjoint source is
+# a unit release at the receptor over the adjoint time step 1. The sensitivity
+# at the source location at adjoint step 11 - k is the measurement for a unit
+# release over the forward step k. The adjoint outflow boundary is the forward
+# inflow boundary.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./sensitivity]
+  [../]
+[]
+
+[Kernels]
+  [./transport]
+    type = STTransport
+    variable = sensitivity
+    adjoint = true
+  [../]
+  [./time]
+    type = STTimeDerivative
+    variable = sensitivity
+  [../]
+[]
+
+[DiracKernels]
+  [./receptor]
+    type = UnitReleaseSource
+    variable = sensitivity
+    point = '500.0 775.0 0.0'
+    release_start = 0.0
+    release_end = 1.0
+  [../]
+[]
+
+[BCs]
+  [./outflow]
+    type = ConstantOutflowBC
+    variable = sensitivity
+    boundary = 'right'
+    velocity = '-100.0 0.0 0.0'
+    adjoint = true
+  [../]
+[]
+
+[Materials]
+  [./adjoint]
+    type = STMaterial
+    diffusivity = 100.0
+    const_velocity = '-100.0 0.0 0.0'
+    adjoint = true
+    adjoint_final_time = 10.0
+  [../]
+[]
+
+[Postprocessors]
+  [./source]
+    type = PointValue
+    variable = sensitivity
+    point = '1200.0 775.0 0.0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,72 @@
+# Adjoint (backward) transport for a receptor at (300, 775) measuring the mean
+# concentration over the forward times [8, 10]. The forward problem ends at
+# T = 10, so the adjoint source is active over the adjoint times [0, 2]. The
+# solution at adjoint time T - t is the sensitivity of the measurement to a
+# unit release rate at forward time t.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./sensitivity]
+  [../]
+[]
+
+[Kernels]
+  [./transport]
+    type = STTransport
+    variable = sensitivity
+    adjoint = true
+  [../]
+  [./time]
+    type = STTimeDerivative
+    variable = sensitivity
+  [../]
+[]
+
+[DiracKernels]
+  [./receptor]
+    type = UnitReleaseSource
+    variable = sensitivity
+    point = '300.0 775.0 0.0'
+    release_start = 0.0
+    release_end = 2.0
+  [../]
+[]
+
+[BCs]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = sensitivity
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./adjoint]
+    type = STMaterial
+    diffusivity = 100.0
+    const_velocity = '-100.0 0.0 0.0'
+    adjoint = true
+    adjoint_final_time = 10.0
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,109 @@
+# Forward half of the duality check of test_duality.py. Unit releases at
+# (1200, 775) over the forward time steps 2 and 4 (one variable each), with the
+# concentration at the receptor (500, 775) at the end of the forward problem
+# (T = 10) as the measurement.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./release_2]
+  [../]
+  [./release_4]
+  [../]
+[]
+
+[Kernels]
+  [./transport_2]
+    type = STTransport
+    variable = release_2
+  [../]
+  [./time_2]
+    type = STTimeDerivative
+    variable = release_2
+  [../]
+  [./transport_4]
+    type = STTransport
+    variable = release_4
+  [../]
+  [./time_4]
+    type = STTimeDerivative
+    variable = release_4
+  [../]
+[]
+
+[DiracKernels]
+  [./source_2]
+    type = UnitReleaseSource
+    variable = release_2
+    point = '1200.0 775.0 0.0'
+    release_start = 1.0
+    release_end = 2.0
+  [../]
+  [./source_4]
+    type = UnitReleaseSource
+    variable = release_4
+    point = '1200.0 775.0 0.0'
+    release_start = 3.0
+    release_end = 4.0
+  [../]
+[]
+
+[BCs]
+  [./outflow_2]
+    type = ConstantOutflowBC
+    variable = release_2
+    boundary = 'left'
+    velocity = '-100.0 0.0 0.0'
+  [../]
+  [./outflow_4]
+    type = ConstantOutflowBC
+    variable = release_4
+    boundary = 'left'
+    velocity = '-100.0 0.0 0.0'
+  [../]
+[]
+
+[Materials]
+  [./forward]
+    type = STMaterial
+    diffusivity = 100.0
+    const_velocity = '-100.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./receptor_2]
+    type = PointValue
+    variable = release_2
+    point = '500.0 775.0 0.0'
+  [../]
+  [./receptor_4]
+    type = PointValue
+    variable = release_4
+    point = '500.0 775.0 0.0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
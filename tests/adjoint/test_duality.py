@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Duality of the forward and adjoint problems for a constant wind: the
+measurement at the receptor for a unit release over the forward time step k
+(forward_duality.i) equals the sensitivity at the release location at the
+adjoint time step N + 1 - k (adjoint_duality.i). The discrete adjoint of the
+Galerkin transport operator with outflow boundaries is the operator of the
+reversed wind, so the two agree to the tolerance of the solves.
+"""
+import unittest
+import numpy as np
+import pandas as pd
+
+class TestDuality(unittest.TestCase):
+    def test_source_receptor(self):
+        forward = pd.read_csv('forward_duality_out.csv').set_index('time')
+        adjoint = pd.read_csv('adjoint_duality_out.csv').set_index('time')
+        num_steps = 10
+
+        for k in (2, 4):
+            measurement = forward.loc[num_steps, 'receptor_' + str(k)]
+            sensitivity = adjoint.loc[num_steps + 1 - k, 'source']
+            self.assertNotEqual(measurement, 0.0)
+            np.testing.assert_allclose(sensitivity, measurement, rtol=1e-8)
+
+if __name__ == '__main__':
+    unittest.main()
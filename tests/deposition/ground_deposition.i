@@ -0,0 +1,167 @@
+# Release near the ground with dry deposition and settling on the bottom
+# boundary (back) and wet scavenging in the column. The dry and wet deposits
+# are accumulated into ground fields every time step and the deposited
+# inventories are reported by the time integrated deposition rates. The
+# integrals of the ground fields over the ground match the inventories.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 5
+  xmin = 0.0
+  xmax = 1000.0
+  ymin = 0.0
+  ymax = 1000.0
+  zmin = 0.0
+  zmax = 200.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[AuxVariables]
+  [./dry_deposit]
+  [../]
+  [./wet_deposit]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./transport]
+    type = STTransport
+    variable = c
+    settling = true
+    wet_deposition = true
+  [../]
+  [./time]
+    type = STTimeDerivative
+    variable = c
+  [../]
+[]
+
+[DiracKernels]
+  [./source]
+    type = ConstantPointSource
+    variable = c
+    value = 1.0
+    point = '300.0 500.0 20.0'
+  [../]
+[]
+
+[BCs]
+  [./ground]
+    type = DryDepositionBC
+    variable = c
+    boundary = back
+    dry_deposition_velocity = 0.01
+    settling_velocity = -0.01
+  [../]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = c
+    boundary = 'left right top bottom front'
+  [../]
+[]
+
+[Materials]
+  [./nuclide]
+    type = GenericCaribouMaterial
+    diffusivity = 10.0
+    const_velocity = '5.0 0.0 0.0'
+    decay_constant = 0.0
+    settling_velocity = -0.01
+    wet_scavenge_constant = 1e-4
+  [../]
+[]
+
+[UserObjects]
+  [./wet_column]
+    type = WetDepositionColumn
+    concentration = c
+    nx = 10
+    ny = 10
+  [../]
+[]
+
+[AuxKernels]
+  [./dry]
+    type = DryDepositionAux
+    variable = dry_deposit
+    concentration = c
+    boundary = back
+    dry_deposition_velocity = 0.01
+    settling_velocity = -0.01
+  [../]
+  [./wet]
+    type = SpatialUserObjectAux
+    variable = wet_deposit
+    user_object = wet_column
+    boundary = back
+    execute_on = timestep_end
+  [../]
+[]
+
+[Postprocessors]
+  [./dry_rate]
+    type = DryDepositionRate
+    variable = c
+    boundary = back
+    dry_deposition_velocity = 0.01
+    settling_velocity = -0.01
+  [../]
+  [./wet_rate]
+    type = WetDepositionRate
+    variable = c
+  [../]
+  [./dry_inventory]
+    type = ImplicitTimeIntegral
+    rate = dry_rate
+  [../]
+  [./wet_inventory]
+    type = ImplicitTimeIntegral
+    rate = wet_rate
+  [../]
+  [./dry_ground]
+    type = SideIntegralVariablePostprocessor
+    variable = dry_deposit
+    boundary = back
+  [../]
+  [./wet_ground]
+    type = SideIntegralVariablePostprocessor
+    variable = wet_deposit
+    boundary = back
+  [../]
+  [./dry_difference]
+    type = DifferencePostprocessor
+    value1 = dry_inventory
+    value2 = dry_ground
+  [../]
+  [./wet_difference]
+    type = DifferencePostprocessor
+    value1 = wet_inventory
+    value2 = wet_ground
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 5
+  dt = 10
+[]
+
+[Outputs]
+  exodus = true
+  [./csv]
+    type = CSV
+    show = 'dry_difference wet_difference'
+  [../]
+[]
@@ -0,0 +1,91 @@
+# Fine near-field domain nested in nested_parent.i, in the coordinates of the
+# parent. The source is only held by this domain, close to its downwind
+# boundary such that the plume leaves it during the run. The mass exported
+# through the boundary is the time integral of the flux applied by the
+# NestedBoundaryBC.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 80
+  ny = 80
+  xmin = 2000.0
+  xmax = 6000.0
+  ymin = 3000.0
+  ymax = 7000.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[AuxVariables]
+  [./parent_c]
+  [../]
+[]
+
+[Kernels]
+  [./transport]
+    type = STTransport
+    variable = c
+  [../]
+  [./time]
+    type = STTimeDerivative
+    variable = c
+  [../]
+[]
+
+[DiracKernels]
+  [./source]
+    type = ConstantPointSource
+    variable = c
+    value = 1.0
+    point = '5500.0 5000.0 0.0'
+  [../]
+[]
+
+[BCs]
+  [./interface]
+    type = NestedBoundaryBC
+    variable = c
+    parent_concentration = parent_c
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./near_field]
+    type = STMaterial
+    diffusivity = 50.0
+    time_dependance = true
+    u_file_name = u.csv
+    v_file_name = v.csv
+    dim_file_name = coords.csv
+  [../]
+[]
+
+[Postprocessors]
+  [./near_field_mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = c
+  [../]
+  [./boundary_flux]
+    type = NestedBoundaryFlux
+    variable = c
+    parent_concentration = parent_c
+    boundary = 'left right top bottom'
+  [../]
+  [./exported_mass]
+    type = ImplicitTimeIntegral
+    rate = boundary_flux
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  dt = 4
+[]
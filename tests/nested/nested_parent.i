@@ -0,0 +1,200 @@
+# Coarse regional domain (500 m elements) holding a fine near-field domain
+# (50 m elements, nested_child.i) around the source. The child runs as a
+# sub-application in the same coordinates (positions = '0 0 0'), such that
+# the materials of both, reading the same wind files, share a single copy of
+# the wind field in each process (wind_memory is that of one copy: 2
+# components, 3 data times of 9 points).
+#
+# Every coarse time step the child receives the coarse concentration, used on
+# inflow and for the diffusive flux through its NestedBoundaryBC, and
+# sub-cycles to the coarse time. Its solution is then projected (conserving
+# the integral) on the coarse mesh and NestedFeedback relaxes the coarse
+# solution toward it in the nest block.
+#
+# The feedback is a source of the coarse domain and the child exchanges mass
+# with it through its boundary, such that the mass of both domains is
+#   regional_mass + near_field_mass
+#     = released + feedback_mass - exported_mass
+# as long as the plume does not reach the regional boundaries. The
+# conservation postprocessor is the difference, which remains at round off
+# level. The coarse domain has no source of its own, so feedback_mass -
+# released is the mass created (or destroyed) by the two-way nesting.
+#
+# The transport kernels of both domains share their name, transport_calls
+# only counts those of this application: the residual of the 800 coarse
+# elements is evaluated twice per (linear) step.
+[Mesh]
+  [./region]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 40
+    ny = 20
+    xmin = 0.0
+    xmax = 20000.0
+    ymin = 0.0
+    ymax = 10000.0
+  [../]
+  [./nest]
+    type = SubdomainBoundingBoxGenerator
+    input = region
+    bottom_left = '2000.0 3000.0 0.0'
+    top_right = '6000.0 7000.0 0.0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[AuxVariables]
+  [./child_c]
+  [../]
+[]
+
+[Kernels]
+  [./transport]
+    type = STTransport
+    variable = c
+  [../]
+  [./time]
+    type = STTimeDerivative
+    variable = c
+  [../]
+  [./feedback]
+    type = NestedFeedback
+    variable = c
+    nested_concentration = child_c
+    block = 1
+  [../]
+[]
+
+[BCs]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = c
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./regional]
+    type = STMaterial
+    diffusivity = 50.0
+    time_dependance = true
+    u_file_name = u.csv
+    v_file_name = v.csv
+    dim_file_name = coords.csv
+  [../]
+[]
+
+[MultiApps]
+  [./near_field]
+    type = TransientMultiApp
+    app_type = caribouApp
+    input_files = nested_child.i
+    positions = '0.0 0.0 0.0'
+    sub_cycling = true
+    execute_on = timestep_begin
+  [../]
+[]
+
+[Transfers]
+  [./to_near_field]
+    type = MultiAppMeshFunctionTransfer
+    direction = to_multiapp
+    multi_app = near_field
+    source_variable = c
+    variable = parent_c
+  [../]
+  [./from_near_field]
+    type = MultiAppProjectionTransfer
+    direction = from_multiapp
+    multi_app = near_field
+    source_variable = c
+    variable = child_c
+  [../]
+  [./near_field_mass]
+    type = MultiAppPostprocessorTransfer
+    direction = from_multiapp
+    multi_app = near_field
+    from_postprocessor = near_field_mass
+    to_postprocessor = near_field_mass
+    reduction_type = sum
+  [../]
+  [./exported_mass]
+    type = MultiAppPostprocessorTransfer
+    direction = from_multiapp
+    multi_app = near_field
+    from_postprocessor = exported_mass
+    to_postprocessor = exported_mass
+    reduction_type = sum
+  [../]
+[]
+
+[Functions]
+  [./released]
+    type = ParsedFunction
+    value = 't'
+  [../]
+[]
+
+[Postprocessors]
+  [./regional_mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = c
+  [../]
+  [./near_field_mass]
+    type = Receiver
+  [../]
+  [./exported_mass]
+    type = Receiver
+  [../]
+  [./feedback_rate]
+    type = NestedFeedbackRate
+    variable = c
+    nested_concentration = child_c
+    block = 1
+  [../]
+  [./feedback_mass]
+    type = ImplicitTimeIntegral
+    rate = feedback_rate
+  [../]
+  [./released]
+    type = FunctionValuePostprocessor
+    function = released
+  [../]
+  [./conservation]
+    type = LinearCombinationPostprocessor
+    pp_names = 'regional_mass near_field_mass exported_mass feedback_mass released'
+    pp_coefs = '1 1 1 -1 -1'
+  [../]
+  [./wind_memory]
+    type = WindFieldMemory
+  [../]
+  [./transport_calls]
+    type = WorkStatisticsValue
+    counter = transport::residual
+    per_step = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 5
+  dt = 20
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  exodus = true
+  [./csv]
+    type = CSV
+    show = 'conservation wind_memory transport_calls'
+  [../]
+[]
@@ -0,0 +1,67 @@
+# Receptor sampling of the field (x + 2 y) / 1000 (5 - |t - 5|), which is
+# linear in space and piecewise linear in time with the kink at a time step:
+# the sampled values, trapezoidal time integrals (25 (x + 2 y) / 1000) and
+# peaks (5 (x + 2 y) / 1000 at t = 5) are exact. The last receptor lies outside
+# of the mesh and reports zeros.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Functions]
+  [./field]
+    type = ParsedFunction
+    value = '(x + 2.0*y)/1000.0*(5.0 - abs(t - 5.0))'
+  [../]
+[]
+
+[AuxKernels]
+  [./concentration]
+    type = FunctionAux
+    variable = concentration
+    function = field
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./receptors]
+    type = ReceptorNetwork
+    variable = concentration
+    receptors_file = receptors.csv
+    output_file = receptor_analytic_values.csv
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+[]
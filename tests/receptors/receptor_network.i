@@ -0,0 +1,89 @@
+# Receptor sampling with the field output disabled. The last receptor lies
+# outside of the mesh.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0.0
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = concentration
+  [../]
+
+  [./advc]
+    type = STAdvection
+    variable = concentration
+    upwinding_type = full
+  [../]
+
+  [./time]
+    type = STTimeDerivative
+    variable = concentration
+  [../]
+[]
+
+[DiracKernels]
+  [./srce]
+    variable = concentration
+    type = ConstantPointSource
+    value = 1.0
+    point = '775.0 775.0 0.0'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = ConstantOutflowBC
+    variable = concentration
+    boundary = '3'
+    velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    const_velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./receptors]
+    type = ReceptorNetwork
+    variable = concentration
+    receptors_file = receptors.csv
+    output_file = receptor_values.csv
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,101 @@
+# Release from a line of point sources in a csv wind field, checkpointed and
+# restarted from a binary snapshot of the wind data or with an updated
+# forecast. The wind memory is that of the csv data when it is parsed, and
+# vanishes when the snapshot is mapped. The concentration starts from zero, or
+# from the state at the checkpoint for the fresh forecast run (see tests).
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = concentration
+  [../]
+
+  [./advc]
+    type = STAdvection
+    variable = concentration
+    upwinding_type = full
+  [../]
+
+  [./time]
+    type = STTimeDerivative
+    variable = concentration
+  [../]
+[]
+
+[DiracKernels]
+  [./line_source]
+    variable = concentration
+    type = MultiPointSource
+    points_file = ../sources/points.csv
+    rates_file = ../sources/rates.csv
+  [../]
+[]
+
+[BCs]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = concentration
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = STMaterial
+    diffusivity = 1.0
+    time_dependance = true
+    u_file_name = u.csv
+    v_file_name = v.csv
+    dim_file_name = coords.csv
+    wind_snapshot = wind_snapshot.cwf
+  [../]
+[]
+
+[Postprocessors]
+  [./mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = concentration
+  [../]
+  [./downwind]
+    type = PointValue
+    variable = concentration
+    point = '1100.0 775.0 0.0'
+  [../]
+  [./wind_memory]
+    type = WindFieldMemory
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  end_time = 5
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  checkpoint = true
+  csv = true
+[]
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Restart from a checkpoint with an updated forecast: the run restarted at t = 5
+on the forecast files, whose time axis starts at t = 5
+(forecast_restart_out.csv), departs from the run restarted on the original
+wind (snapshot_restart_out.csv), and follows a fresh run on the forecast files
+starting from the checkpointed concentration (forecast_fresh_out.csv).
+"""
+import unittest
+import numpy as np
+import pandas as pd
+
+class TestForecastRestart(unittest.TestCase):
+    def setUp(self):
+        self.forecast = pd.read_csv('forecast_restart_out.csv').set_index('time')
+        self.original = pd.read_csv('snapshot_restart_out.csv').set_index('time')
+        self.fresh = pd.read_csv('forecast_fresh_out.csv').set_index('time')
+        self.times = [t for t in self.forecast.index if t > 5.0]
+
+    def test_new_wind(self):
+        self.assertEqual(self.times, [6.0, 7.0, 8.0, 9.0, 10.0])
+        for t in self.times:
+            self.assertGreater(abs(self.forecast.loc[t, 'downwind'] - self.original.loc[t, 'downwind']),
+                               1e-3 * abs(self.original.loc[t, 'downwind']))
+
+    def test_matches_fresh_run(self):
+        for name in ('mass', 'downwind'):
+            self.assertNotEqual(self.fresh.loc[10.0, name], 0.0)
+            np.testing.assert_allclose(self.forecast.loc[self.times, name],
+                                       self.fresh.loc[self.times, name],
+                                       rtol=1e-6, atol=1e-12)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Restart from a checkpoint with a binary snapshot of the wind data: the run
+checkpointed at t = 5 and restarted to t = 10 (snapshot_restart_out.csv)
+maps the snapshot rather than parsing the csv files, and follows the run
+reaching t = 10 uninterrupted (uninterrupted_out.csv).
+"""
+import unittest
+import numpy as np
+import pandas as pd
+
+class TestRestart(unittest.TestCase):
+    def setUp(self):
+        self.restarted = pd.read_csv('snapshot_restart_out.csv').set_index('time')
+        self.uninterrupted = pd.read_csv('uninterrupted_out.csv').set_index('time')
+
+    def test_snapshot_mapped(self):
+        np.testing.assert_array_equal(self.restarted['wind_memory'], 0.0)
+
+    def test_continuity(self):
+        times = [t for t in self.restarted.index if t > 5.0]
+        self.assertEqual(times, [6.0, 7.0, 8.0, 9.0, 10.0])
+        for name in ('mass', 'downwind'):
+            self.assertNotEqual(self.uninterrupted.loc[10.0, name], 0.0)
+            np.testing.assert_allclose(self.restarted.loc[times, name],
+                                       self.uninterrupted.loc[times, name],
+                                       rtol=1e-8, atol=1e-12)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,112 @@
+# Advection-diffusion of a front in 1D, compared to the analytic solution for
+# a step initially at x = 0 in an infinite domain:
+#   c(x, t) = erfc((x - v t) / sqrt(4 D t)) / 2
+# The run starts from the solution at t = 50 and ends at t = 350, the point
+# values across the front are compared to it. The element Peclet number is
+# 1.25, and the front spans about 30 elements.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 400
+  xmin = 0.0
+  xmax = 1000.0
+[]
+
+[Functions]
+  [./front]
+    type = ParsedFunction
+    value = '0.5 * erfc((x - t) / sqrt(4 * t))'
+  [../]
+[]
+
+[Variables]
+  [./c]
+    order = FIRST
+    family = LAGRANGE
+
+    [./InitialCondition]
+      type = FunctionIC
+      function = front
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = c
+  [../]
+
+  [./advc]
+    type = STAdvection
+    variable = c
+    upwinding_type = supg
+  [../]
+
+  [./time]
+    type = STTimeDerivative
+    variable = c
+  [../]
+[]
+
+[BCs]
+  [./inflow]
+    type = FunctionDirichletBC
+    variable = c
+    boundary = left
+    function = front
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    const_velocity = '1.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./c_330]
+    type = PointValue
+    variable = c
+    point = '330.0 0.0 0.0'
+  [../]
+  [./c_340]
+    type = PointValue
+    variable = c
+    point = '340.0 0.0 0.0'
+  [../]
+  [./c_350]
+    type = PointValue
+    variable = c
+    point = '350.0 0.0 0.0'
+  [../]
+  [./c_360]
+    type = PointValue
+    variable = c
+    point = '360.0 0.0 0.0'
+  [../]
+  [./c_370]
+    type = PointValue
+    variable = c
+    point = '370.0 0.0 0.0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  scheme = 'bdf2'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  start_time = 50
+  end_time = 350
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'final'
+  csv = true
+[]
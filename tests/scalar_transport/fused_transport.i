@@ -0,0 +1,113 @@
+# Transport of the same species by the fused STTransport kernel (fused) and by
+# the separate kernels (separate). The difference postprocessor should remain
+# at round off level.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./fused]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./separate]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./fused_transport]
+    type = STTransport
+    variable = fused
+    decay = true
+    settling = true
+    wet_deposition = true
+  [../]
+  [./fused_time]
+    type = STTimeDerivative
+    variable = fused
+  [../]
+
+  [./diff]
+    type = STDiffusion
+    variable = separate
+  [../]
+  [./advc]
+    type = STAdvection
+    variable = separate
+  [../]
+  [./decay]
+    type = SpeciesDecay
+    variable = separate
+  [../]
+  [./settling]
+    type = SpeciesSettling
+    variable = separate
+  [../]
+  [./wet_deposition]
+    type = SpeciesWetDeposition
+    variable = separate
+  [../]
+  [./separate_time]
+    type = STTimeDerivative
+    variable = separate
+  [../]
+[]
+
+[DiracKernels]
+  [./fused_source]
+    variable = fused
+    type = ConstantPointSource
+    value = 1.0
+    point = '775.0 775.0 0.0'
+  [../]
+  [./separate_source]
+    variable = separate
+    type = ConstantPointSource
+    value = 1.0
+    point = '775.0 775.0 0.0'
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = GenericCaribouMaterial
+    diffusivity = '0.5 1.0'
+    const_velocity = '-5.0 2.0 0.0'
+    decay_constant = 1e-3
+    settling_velocity = -0.1
+    wet_scavenge_constant = 1e-4
+  [../]
+[]
+
+[Postprocessors]
+  [./difference]
+    type = ElementL2Difference
+    variable = fused
+    other_variable = separate
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 5
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
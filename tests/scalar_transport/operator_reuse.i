@@ -0,0 +1,92 @@
+# Transport by a constant wind solved with NEWTON and LU, with or without a
+# LinearOperatorReuse (added from the command line). The operator is
+# unchanged over the run, so it is only built on the first step, and the
+# solution is the same as without reuse (test_operator_reuse.py).
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 40
+  ny = 40
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = concentration
+  [../]
+
+  [./advc]
+    type = STAdvection
+    variable = concentration
+    upwinding_type = full
+  [../]
+
+  [./time]
+    type = STTimeDerivative
+    variable = concentration
+  [../]
+[]
+
+[DiracKernels]
+  [./srce]
+    variable = concentration
+    type = ConstantPointSource
+    value = 1.0
+    point = '775.0 775.0 0.0'
+  [../]
+[]
+
+[BCs]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = concentration
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    const_velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = concentration
+  [../]
+  [./downwind]
+    type = PointValue
+    variable = concentration
+    point = '697.5 775.0 0.0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
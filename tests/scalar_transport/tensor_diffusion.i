@@ -0,0 +1,77 @@
+# Steady diffusion with a full (non symmetric) diffusion tensor, manufactured
+# such that the solution u = x y + 2 y z + 3 x z is in the trilinear finite
+# element space and is reproduced exactly:
+#   -div(K grad(u)) = -(Kxy + Kyx) - 2 (Kyz + Kzy) - 3 (Kxz + Kzx) = -4.3
+# Every off diagonal component of the tensor enters the source term.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 4
+  ny = 4
+  nz = 4
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Functions]
+  [./exact]
+    type = ParsedFunction
+    value = 'x * y + 2 * y * z + 3 * x * z'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    value = -4.3
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = 'left right top bottom front back'
+    function = exact
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = '1.0 0.2 0.1
+                   0.3 2.0 0.4
+                   0.5 0.6 3.0'
+    const_velocity = '0.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./error]
+    type = ElementL2Error
+    variable = u
+    function = exact
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  nl_abs_tol = 1e-12
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
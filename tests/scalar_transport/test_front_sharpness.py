@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Sharpness of the advected front of advection_front.i: the L2 error to the
+analytic solution with flux limiting (front_flux_limited_out.csv) is well
+below that of full upwinding (front_full_out.csv), whose numerical diffusion
+(v h / 2 = 1.25) exceeds the physical diffusivity.
+"""
+import unittest
+import pandas as pd
+
+class TestFrontSharpness(unittest.TestCase):
+    def test_l2_error(self):
+        full = pd.read_csv('front_full_out.csv')['error'].iloc[-1]
+        limited = pd.read_csv('front_flux_limited_out.csv')['error'].iloc[-1]
+
+        self.assertGreater(full, 0.0)
+        self.assertLess(limited, 0.5 * full)
+
+if __name__ == '__main__':
+    unittest.main()
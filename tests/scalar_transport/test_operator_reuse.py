@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Reuse of the transport operator across time steps (operator_reuse_out.csv)
+against a run rebuilding it every step (operator_rebuild_out.csv): the
+constant operator is only built once, and the solutions agree to the
+tolerance of the solves.
+"""
+import unittest
+import numpy as np
+import pandas as pd
+
+class TestOperatorReuse(unittest.TestCase):
+    def test_solution(self):
+        reuse = pd.read_csv('operator_reuse_out.csv').set_index('time')
+        rebuild = pd.read_csv('operator_rebuild_out.csv').set_index('time')
+
+        np.testing.assert_array_equal(reuse['operator_rebuilds'], 1.0)
+        self.assertEqual(list(reuse.index), list(rebuild.index))
+        for name in ('mass', 'downwind'):
+            self.assertNotEqual(rebuild[name].iloc[-1], 0.0)
+            np.testing.assert_allclose(reuse[name], rebuild[name], rtol=1e-8, atol=1e-12)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,80 @@
+# Steady diffusion with the height dependant profile K(z) = 1 + z replacing
+# the vertical diffusion coefficient. The solution u = z is reproduced exactly
+# with the source
+#   -d/dz(K(z) du/dz) = -1
+# which would not balance the constant coefficient of the other directions.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 8
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Functions]
+  [./exact]
+    type = ParsedFunction
+    value = 'z'
+  [../]
+  [./profile]
+    type = ParsedFunction
+    value = '1 + z'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    value = -1.0
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = 'left right top bottom front back'
+    function = exact
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    vertical_diffusivity = profile
+    const_velocity = '0.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./error]
+    type = ElementL2Error
+    variable = u
+    function = exact
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  nl_abs_tol = 1e-12
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,80 @@
+# Release from a line of point sources read from a source table.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0.0
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = concentration
+  [../]
+
+  [./advc]
+    type = STAdvection
+    variable = concentration
+    upwinding_type = full
+  [../]
+
+  [./time]
+    type = STTimeDerivative
+    variable = concentration
+  [../]
+[]
+
+[DiracKernels]
+  [./line_source]
+    variable = concentration
+    type = MultiPointSource
+    points_file = points.csv
+    rates_file = rates.csv
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = ConstantOutflowBC
+    variable = concentration
+    boundary = '3'
+    velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    const_velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  exodus = true
+[]
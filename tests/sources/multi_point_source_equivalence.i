@@ -0,0 +1,152 @@
+# The release of multi_point_source.i (source table in points.csv and
+# rates.csv) compared to the same release through one PieceWisePointSource
+# per row of the table. The two coincident sources of the table are merged by
+# MultiPointSource and kept apart here.
+#
+# No mass leaves the domain within 10 s, the mass released is
+#   4.5 per second for t in [0, 3), 2 per second for t in [3, 6), then 0
+# with the rates taken at the end of each (implicit) time step.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./multi]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./separate]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./diff_multi]
+    type = STDiffusion
+    variable = multi
+  [../]
+  [./advc_multi]
+    type = STAdvection
+    variable = multi
+    upwinding_type = full
+  [../]
+  [./time_multi]
+    type = STTimeDerivative
+    variable = multi
+  [../]
+
+  [./diff_separate]
+    type = STDiffusion
+    variable = separate
+  [../]
+  [./advc_separate]
+    type = STAdvection
+    variable = separate
+    upwinding_type = full
+  [../]
+  [./time_separate]
+    type = STTimeDerivative
+    variable = separate
+  [../]
+[]
+
+[DiracKernels]
+  [./line_source]
+    variable = multi
+    type = MultiPointSource
+    points_file = points.csv
+    rates_file = rates.csv
+  [../]
+
+  [./source_0]
+    variable = separate
+    type = PieceWisePointSource
+    point = '1200.0 700.0 0.0'
+    activation_times = '0.0 3.0 6.0'
+    rates = '1.0 0.5 0.0'
+  [../]
+  [./source_1]
+    variable = separate
+    type = PieceWisePointSource
+    point = '1200.0 775.0 0.0'
+    activation_times = '0.0 3.0 6.0'
+    rates = '2.0 1.0 0.0'
+  [../]
+  [./source_2]
+    variable = separate
+    type = PieceWisePointSource
+    point = '1200.0 850.0 0.0'
+    activation_times = '0.0 3.0 6.0'
+    rates = '1.0 0.5 0.0'
+  [../]
+  [./source_3]
+    variable = separate
+    type = PieceWisePointSource
+    point = '1200.0 850.0 0.0'
+    activation_times = '0.0 3.0 6.0'
+    rates = '0.5 0.0 0.0'
+  [../]
+[]
+
+[BCs]
+  [./left_multi]
+    type = ConstantOutflowBC
+    variable = multi
+    boundary = '3'
+    velocity = '-10.0 0.0 0.0'
+  [../]
+  [./left_separate]
+    type = ConstantOutflowBC
+    variable = separate
+    boundary = '3'
+    velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    const_velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./difference]
+    type = ElementL2Difference
+    variable = multi
+    other_variable = separate
+  [../]
+  [./multi_mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = multi
+  [../]
+  [./separate_mass]
+    type = ElementIntegralVariablePostprocessor
+    variable = separate
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
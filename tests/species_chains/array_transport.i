@@ -0,0 +1,146 @@
+# Transport of a single species by the array kernels (array, one component)
+# and by the scalar kernels (scalar): full upwinding, anisotropic diffusion,
+# wet deposition, a source released over a small area and outflow through the
+# open boundaries. The difference between the two solutions should remain at
+# round off level.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./scalar]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./array]
+    order = FIRST
+    family = LAGRANGE
+    components = 1
+  [../]
+[]
+
+[AuxVariables]
+  [./array_0]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Functions]
+  [./source]
+    type = ParsedFunction
+    value = 'if(x > 232.5 & x < 542.5 & y > 697.5 & y < 852.5, 1e-3, 0)'
+  [../]
+[]
+
+[Kernels]
+  [./scalar_diff]
+    type = STDiffusion
+    variable = scalar
+  [../]
+  [./scalar_advc]
+    type = STAdvection
+    variable = scalar
+    upwinding_type = full
+  [../]
+  [./scalar_wet_deposition]
+    type = SpeciesWetDeposition
+    variable = scalar
+  [../]
+  [./scalar_source]
+    type = BodyForce
+    variable = scalar
+    function = source
+  [../]
+  [./scalar_time]
+    type = STTimeDerivative
+    variable = scalar
+  [../]
+
+  [./array_diff]
+    type = STArrayDiffusion
+    variable = array
+  [../]
+  [./array_advc]
+    type = STArrayAdvection
+    variable = array
+    upwinding_type = full
+  [../]
+  [./array_wet_deposition]
+    type = STArrayWetDeposition
+    variable = array
+  [../]
+  [./array_source]
+    type = ArrayBodyForce
+    variable = array
+    function = source
+  [../]
+  [./array_time]
+    type = ArrayTimeDerivative
+    variable = array
+    time_derivative_coefficient = 1.0
+  [../]
+[]
+
+[AuxKernels]
+  [./array_0]
+    type = ArrayVariableComponent
+    variable = array_0
+    array_variable = array
+    component = 0
+  [../]
+[]
+
+[BCs]
+  [./scalar_outflow]
+    type = MaterialOutflowBC
+    variable = scalar
+    boundary = 'left right top bottom'
+  [../]
+  [./array_outflow]
+    type = STArrayOutflowBC
+    variable = array
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = GenericCaribouMaterial
+    diffusivity = '5.0 10.0'
+    const_velocity = '-5.0 2.0 0.0'
+    decay_constant = 0.0
+    wet_scavenge_constant = 1e-4
+  [../]
+[]
+
+[Postprocessors]
+  [./difference]
+    type = ElementL2Difference
+    variable = scalar
+    other_variable = array_0
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 10
+  dt = 20
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,109 @@
+# Advection and diffusion of a small source term inventory held in a single
+# array variable: Te-132 -> I-132 and Cs-137.
+#
+# Without boundary conditions no mass leaves the domain, and the inventories
+# (integrals of each species) follow the Bateman solution. The final
+# inventories are compared to it, the second order time integration keeping
+# the error well below the comparison tolerance:
+#   Te(t) = exp(-l1 t)
+#   I(t)  = l1 / (l2 - l1) (exp(-l1 t) - exp(-l2 t))
+#   Cs(t) = exp(-l3 t)
+# times the area of the domain.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./species]
+    order = FIRST
+    family = LAGRANGE
+    components = 3
+
+    [./InitialCondition]
+      type = ArrayConstantIC
+      value = '1.0 0.0 1.0'
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STArrayDiffusion
+    variable = species
+  [../]
+
+  [./advc]
+    type = STArrayAdvection
+    variable = species
+  [../]
+
+  [./decay]
+    type = STArrayDecayChain
+    variable = species
+    decay_constants = '2.507e-6 8.390e-5 7.302e-10'
+    parents = '0'
+    daughters = '1'
+    branching_fractions = '1.0'
+  [../]
+
+  [./time]
+    type = ArrayTimeDerivative
+    variable = species
+    time_derivative_coefficient = 1.0
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 1.0
+    const_velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./te_132]
+    type = ElementIntegralArrayVariablePostprocessor
+    variable = species
+    component = 0
+  [../]
+  [./i_132]
+    type = ElementIntegralArrayVariablePostprocessor
+    variable = species
+    component = 1
+  [../]
+  [./cs_137]
+    type = ElementIntegralArrayVariablePostprocessor
+    variable = species
+    component = 2
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  scheme = 'bdf2'
+  num_steps = 300
+  dt = 60
+  nl_rel_tol = 1e-10
+[]
+
+[Outputs]
+  execute_on = 'final'
+  csv = true
+[]
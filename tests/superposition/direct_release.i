@@ -0,0 +1,94 @@
+# Direct run of the release schedule of schedule.csv, to be compared with
+# the superposition of the unit release responses listed in manifest.csv:
+#   source a: 2 per second over [0, 4), 0.5 per second over [4, 6)
+#   source b: 1 per second over [0, 6)
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./c]
+  [../]
+[]
+
+[Kernels]
+  [./transport]
+    type = STTransport
+    variable = c
+  [../]
+  [./time]
+    type = STTimeDerivative
+    variable = c
+  [../]
+[]
+
+[DiracKernels]
+  [./release_a_0]
+    type = UnitReleaseSource
+    variable = c
+    point = '1200.0 740.0 0.0'
+    amount = 8.0
+    release_start = 0.0
+    release_end = 4.0
+  [../]
+  [./release_a_1]
+    type = UnitReleaseSource
+    variable = c
+    point = '1200.0 740.0 0.0'
+    amount = 1.0
+    release_start = 4.0
+    release_end = 6.0
+  [../]
+  [./release_b]
+    type = UnitReleaseSource
+    variable = c
+    point = '1100.0 810.0 0.0'
+    amount = 6.0
+    release_start = 0.0
+    release_end = 6.0
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 100.0
+    const_velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./receptor_a]
+    type = PointValue
+    variable = c
+    point = '1000.0 740.0 0.0'
+  [../]
+  [./receptor_b]
+    type = PointValue
+    variable = c
+    point = '900.0 810.0 0.0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-12
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
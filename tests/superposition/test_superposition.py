@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Compares the superposition of the unit release responses listed in
+manifest.csv for the schedule of schedule.csv with the direct run of the same
+schedule (direct_release.i). Transport being linear, the two must agree to
+the tolerance of the solves.
+"""
+import os
+import sys
+import unittest
+import numpy as np
+import pandas as pd
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                '..', '..', 'python'))
+from superposition import superpose
+
+class TestSuperposition(unittest.TestCase):
+    def test_direct_release(self):
+        nuclides = pd.read_csv('nuclides.csv')
+        decay_constants = dict(zip(nuclides['nuclide'],
+                                   nuclides['decay_constant']))
+        combined = superpose(pd.read_csv('manifest.csv'),
+                             pd.read_csv('schedule.csv'), decay_constants)
+        direct = pd.read_csv('direct_release_out.csv')
+
+        receptors = list(direct.columns[1:])
+        self.assertEqual(list(combined.columns[3:]), receptors)
+        np.testing.assert_allclose(combined['time'].values,
+                                   direct['time'].values)
+        np.testing.assert_allclose(combined[receptors].values,
+                                   direct[receptors].values,
+                                   rtol=1e-8, atol=1e-12)
+
+if __name__ == '__main__':
+    unittest.main()
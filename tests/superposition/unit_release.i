@@ -0,0 +1,87 @@
+# Unit release responses of one source location for two release intervals,
+# computed in a single run (one variable per interval). The receptor time
+# series can be combined with python/superposition.py.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+  zmax = 0.0
+[]
+
+[Variables]
+  [./unit_0]
+  [../]
+  [./unit_1]
+  [../]
+[]
+
+[Kernels]
+  [./transport_0]
+    type = STTransport
+    variable = unit_0
+  [../]
+  [./time_0]
+    type = STTimeDerivative
+    variable = unit_0
+  [../]
+  [./transport_1]
+    type = STTransport
+    variable = unit_1
+  [../]
+  [./time_1]
+    type = STTimeDerivative
+    variable = unit_1
+  [../]
+[]
+
+[DiracKernels]
+  [./release_0]
+    type = UnitReleaseSource
+    variable = unit_0
+    point = '1200.0 775.0 0.0'
+    release_start = 0.0
+    release_end = 5.0
+  [../]
+  [./release_1]
+    type = UnitReleaseSource
+    variable = unit_1
+    point = '1200.0 775.0 0.0'
+    release_start = 5.0
+    release_end = 10.0
+  [../]
+[]
+
+[Materials]
+  [./test]
+    type = STMaterial
+    diffusivity = 100.0
+    const_velocity = '-10.0 0.0 0.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./mass_0]
+    type = ElementIntegralVariablePostprocessor
+    variable = unit_0
+  [../]
+  [./mass_1]
+    type = ElementIntegralVariablePostprocessor
+    variable = unit_1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 12
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,150 @@
+# Same wind field as wind_sampling.i, read by two block restricted
+# materials. Both share a single copy of the wind data in each process: the
+# memory held is that of one copy of the csv data (2 components, 3 data times
+# of 9 points).
+[Mesh]
+  [./region]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 20
+    ny = 20
+    xmin = 0.0
+    xmax = 1550.0
+    ymin = 0.0
+    ymax = 1550.0
+  [../]
+  [./west]
+    type = SubdomainBoundingBoxGenerator
+    input = region
+    bottom_left = '0.0 0.0 0.0'
+    top_right = '775.0 1550.0 0.0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./u_wind]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./v_wind]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = concentration
+  [../]
+
+  [./advc]
+    type = STAdvection
+    variable = concentration
+    upwinding_type = full
+  [../]
+
+  [./time]
+    type = STTimeDerivative
+    variable = concentration
+  [../]
+[]
+
+[AuxKernels]
+  [./u_wind]
+    type = MaterialRealVectorValueAux
+    variable = u_wind
+    property = material_velocity
+    component = 0
+  [../]
+  [./v_wind]
+    type = MaterialRealVectorValueAux
+    variable = v_wind
+    property = material_velocity
+    component = 1
+  [../]
+[]
+
+[DiracKernels]
+  [./srce]
+    variable = concentration
+    type = ConstantPointSource
+    value = 1.0
+    point = '116.25 1356.25 0.0'
+  [../]
+[]
+
+[BCs]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = concentration
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./wind_west]
+    type = STMaterial
+    block = 1
+    diffusivity = 1.0
+    time_dependance = true
+    u_file_name = u.csv
+    v_file_name = v.csv
+    dim_file_name = coords.csv
+  [../]
+  [./wind_east]
+    type = STMaterial
+    block = 0
+    diffusivity = 1.0
+    time_dependance = true
+    u_file_name = u.csv
+    v_file_name = v.csv
+    dim_file_name = coords.csv
+  [../]
+[]
+
+[Postprocessors]
+  [./u_p1]
+    type = PointValue
+    variable = u_wind
+    point = '116.25 1356.25 0.0'
+  [../]
+  [./u_p2]
+    type = PointValue
+    variable = u_wind
+    point = '1511.25 193.75 0.0'
+  [../]
+  [./v_p1]
+    type = PointValue
+    variable = v_wind
+    point = '116.25 1356.25 0.0'
+  [../]
+  [./v_p2]
+    type = PointValue
+    variable = v_wind
+    point = '1511.25 193.75 0.0'
+  [../]
+  [./wind_memory]
+    type = WindFieldMemory
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
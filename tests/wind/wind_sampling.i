@@ -0,0 +1,133 @@
+# Transport in a time dependant csv wind field, linear in x, y and t:
+#   u = -10 + 0.002 x + 0.001 y + 0.4 t
+#   v = 1 - 0.001 x + 0.002 y - 0.1 t
+# given at t = 0, 5 and 10. The interpolated velocity is exact, the sampled
+# components are compared at the centroids of two elements (the elemental
+# averages of a linear field) to the analytical values. The point source
+# reinitializes its element with other quadrature points on every residual
+# evaluation (at the centroid of the first element sampled), which must not
+# disturb the cached element velocities.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = 0.0
+  xmax = 1550.0
+  ymin = 0.0
+  ymax = 1550.0
+[]
+
+[Variables]
+  [./concentration]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./u_wind]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./v_wind]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = STDiffusion
+    variable = concentration
+  [../]
+
+  [./advc]
+    type = STAdvection
+    variable = concentration
+    upwinding_type = full
+  [../]
+
+  [./time]
+    type = STTimeDerivative
+    variable = concentration
+  [../]
+[]
+
+[AuxKernels]
+  [./u_wind]
+    type = MaterialRealVectorValueAux
+    variable = u_wind
+    property = material_velocity
+    component = 0
+  [../]
+  [./v_wind]
+    type = MaterialRealVectorValueAux
+    variable = v_wind
+    property = material_velocity
+    component = 1
+  [../]
+[]
+
+[DiracKernels]
+  [./srce]
+    variable = concentration
+    type = ConstantPointSource
+    value = 1.0
+    point = '116.25 1356.25 0.0'
+  [../]
+[]
+
+[BCs]
+  [./outflow]
+    type = MaterialOutflowBC
+    variable = concentration
+    boundary = 'left right top bottom'
+  [../]
+[]
+
+[Materials]
+  [./wind]
+    type = STMaterial
+    diffusivity = 1.0
+    time_dependance = true
+    u_file_name = u.csv
+    v_file_name = v.csv
+    dim_file_name = coords.csv
+  [../]
+[]
+
+[Postprocessors]
+  [./u_p1]
+    type = PointValue
+    variable = u_wind
+    point = '116.25 1356.25 0.0'
+  [../]
+  [./u_p2]
+    type = PointValue
+    variable = u_wind
+    point = '1511.25 193.75 0.0'
+  [../]
+  [./v_p1]
+    type = PointValue
+    variable = v_wind
+    point = '116.25 1356.25 0.0'
+  [../]
+  [./v_p2]
+    type = PointValue
+    variable = v_wind
+    point = '1511.25 193.75 0.0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 10
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]